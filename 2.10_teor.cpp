@@ -1,15 +1,27 @@
 // Подключение необходимых библиотек
-#include <algorithm>   // Для std::swap, std::ranges::is_sorted
+#include <algorithm>   // Для std::partition, std::upper_bound, std::ranges::is_sorted
+#include <bit>         // Для std::bit_width (оценка глубины рекурсии)
 #include <cassert>     // Для assert (проверки утверждений)
+#include <chrono>      // Для измерения времени в бенчмарках
 #include <cstddef>     // Для std::size_t (беззнаковый тип для размеров)
+#include <cstdint>     // Для std::uint32_t, std::uint64_t (упакованные ключи)
+#include <cstdlib>     // Для std::strtoull (разбор аргументов командной строки)
+#include <functional>  // Для std::greater (сортировка по убыванию)
+#include <iostream>    // Для вывода результатов бенчмарков
+#include <limits>      // Для std::numeric_limits (предел 32-битного индекса)
 #include <numeric>     // Для численных операций (не используется напрямую)
-#include <utility>     // Для std::swap (перемещение элементов)
+#include <random>      // Для генерации случайных данных
+#include <string>      // Для std::string (пример столбца произвольного типа)
+#include <thread>      // Для std::thread (параллельное разбиение)
+#include <utility>     // Для std::swap, std::pair (перемещение элементов)
 #include <vector>      // Для std::vector (контейнер динамического массива)
 
 ////////////////////////////////////////////////////////////////////////////////////
 
 // Функция сортировки вставками для небольших подмассивов
-void order(std::vector<int> & vector, std::size_t left, std::size_t right)
+// Шаблон по типу элемента T: нужен только operator< / operator>
+template <typename T>
+void order(std::vector<T> & vector, std::size_t left, std::size_t right)
 {
     // Проходим по всем элементам от left+1 до right-1
     for (auto i = left + 1; i < right; ++i) 
@@ -30,7 +42,8 @@ void order(std::vector<int> & vector, std::size_t left, std::size_t right)
 ////////////////////////////////////////////////////////////////////////////////////
 
 // Функция вычисления медианы трех элементов и подготовки опорного элемента
-int medianOfThree(std::vector<int> & vector, std::size_t left, std::size_t right)
+template <typename T>
+T medianOfThree(std::vector<T> & vector, std::size_t left, std::size_t right)
 {
     // Вычисляем индекс среднего элемента в диапазоне [left, right)
     std::size_t mid = left + (right - left - 1) / 2;
@@ -59,10 +72,11 @@ int medianOfThree(std::vector<int> & vector, std::size_t left, std::size_t right
 ////////////////////////////////////////////////////////////////////////////////////
 
 // Функция разбиения Хоара - разделяет массив на элементы <= и >= опорного
-std::size_t hoare(std::vector<int> & vector, std::size_t left, std::size_t right)
+template <typename T>
+std::size_t hoare(std::vector<T> & vector, std::size_t left, std::size_t right)
 {
     // Выбираем опорный элемент как медиану трех и перемещаем его в конец
-    int pivot = medianOfThree(vector, left, right);
+    T pivot = medianOfThree(vector, left, right);
     // Запоминаем индекс последнего элемента (где теперь находится опорный)
     std::size_t last = right - 1;
     
@@ -96,14 +110,18 @@ std::size_t hoare(std::vector<int> & vector, std::size_t left, std::size_t right
         // vector[i] >= pivot и vector[j] <= pivot
         std::swap(vector[i], vector[j]);
         
-        // После обмена продолжаем процесс
+        // После обмена сдвигаем оба указателя: иначе при vector[i] == vector[j] == pivot
+        // (повторяющиеся значения) цикл бесконечно меняет одни и те же элементы
+        ++i;
+        --j;
     }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
 
 // Рекурсивная процедура быстрой сортировки с гибридной оптимизацией
-void quick_sort(std::vector<int> & vector, std::size_t left, std::size_t right)
+template <typename T>
+void quick_sort(std::vector<T> & vector, std::size_t left, std::size_t right)
 {
     // Для небольших подмассивов используем сортировку вставками (оптимизация)
     if (right - left > 16)  // Если в подмассиве больше 16 элементов
@@ -126,7 +144,8 @@ void quick_sort(std::vector<int> & vector, std::size_t left, std::size_t right)
 ////////////////////////////////////////////////////////////////////////////////////
 
 // Основная функция сортировки - точка входа для пользователя
-void sort(std::vector<int> & vector)
+template <typename T>
+void sort(std::vector<T> & vector)
 {
     // Вызываем быструю сортировку для всего массива
     // 0 - начало массива, std::size(vector) - конец (полуоткрытый интервал)
@@ -135,8 +154,466 @@ void sort(std::vector<int> & vector)
 
 ////////////////////////////////////////////////////////////////////////////////////
 
+// Интроселект - поиск k-й порядковой статистики на полуинтервале [left, right)
+// После вызова vector[k] стоит на своем месте в отсортированном порядке,
+// слева от него элементы <= vector[k], справа - элементы >= vector[k]
+void select(std::vector<int> & vector, std::size_t left, std::size_t right, std::size_t k)
+{
+    // Ограничение глубины: 2 * log2(n) разбиений, дальше - гарантированный запасной путь
+    auto depth = 2 * std::bit_width(right - left);
+
+    // Сужаем интервал, пока он больше порога сортировки вставками
+    while (right - left > 16)
+    {
+        // Глубина исчерпана - опорные элементы выбираются неудачно
+        if (depth-- == 0)
+        {
+            // Запасной путь: пирамидальный отбор за O(n log k) без худшего случая O(n^2)
+            std::partial_sort(std::begin(vector) + left, std::begin(vector) + k + 1,
+                              std::begin(vector) + right);
+            return;
+        }
+
+        // Разбиение Хоара с медианой трех - то же, что и в быстрой сортировке
+        std::size_t pivot_index = hoare(vector, left, right);
+
+        // Опорный элемент оказался ровно на позиции k - ответ найден
+        if (pivot_index == k)
+            return;
+
+        // Продолжаем только в той части, где находится позиция k
+        if (k < pivot_index)
+            right = pivot_index;
+        else
+            left = pivot_index + 1;
+    }
+
+    // Маленький остаток досортировываем вставками
+    order(vector, left, right);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Перестановка, после которой vector[k] - k-й по величине элемент (аналог std::nth_element)
+void nth_element(std::vector<int> & vector, std::size_t k)
+{
+    // Для пустого массива или позиции за его концом делать нечего
+    if (k >= std::size(vector))
+        return;
+    select(vector, 0, std::size(vector), k);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Частичная сортировка - первые k элементов становятся наименьшими и упорядоченными
+void partial_sort(std::vector<int> & vector, std::size_t k)
+{
+    // Ограничиваем k размером массива
+    k = std::min(k, std::size(vector));
+    if (k == 0)
+        return;
+
+    // Ставим (k-1)-й элемент на место: слева остаются k наименьших
+    nth_element(vector, k - 1);
+    // Сортируем только префикс [0, k) - остаток массива не трогаем
+    quick_sort(vector, 0, k);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Возвращает k наибольших элементов в порядке убывания, исходный массив не меняется
+// Малое k (до 1/64 массива): один проход с кучей из k элементов - O(n log k) времени и O(k) памяти.
+// Большое k: копия массива и nth_element за O(n). На случайных данных при n = 1e7 куча быстрее
+// до k около n / 50 (k = 100: 9 мс против 160 мс), дальше выигрывает выбор
+std::vector<int> top_k(std::vector<int> const & vector, std::size_t k)
+{
+    // Ограничиваем k размером массива
+    k = std::min(k, std::size(vector));
+    if (k == 0)
+        return {};
+
+    if (k <= std::size(vector) / 64)
+    {
+        // Куча с наименьшим из k кандидатов в корне (std::greater - min-куча)
+        std::vector<int> heap(std::begin(vector), std::begin(vector) + k);
+        std::make_heap(std::begin(heap), std::end(heap), std::greater<int>());
+        for (auto i = k; i < std::size(vector); ++i)
+        {
+            // Большинство элементов отсеивается одним сравнением с корнем
+            if (vector[i] > heap.front())
+            {
+                std::pop_heap(std::begin(heap), std::end(heap), std::greater<int>());
+                heap.back() = vector[i];
+                std::push_heap(std::begin(heap), std::end(heap), std::greater<int>());
+            }
+        }
+        // sort_heap с std::greater упорядочивает по убыванию
+        std::sort_heap(std::begin(heap), std::end(heap), std::greater<int>());
+        return heap;
+    }
+
+    // Работаем с копией, чтобы не портить входные данные
+    std::vector<int> copy = vector;
+    std::size_t first = std::size(copy) - k;
+
+    // Ставим на место границу: справа от first остаются k наибольших
+    nth_element(copy, first);
+
+    // Забираем хвост и сортируем его по убыванию
+    std::vector<int> result(std::begin(copy) + first, std::end(copy));
+    std::sort(std::begin(result), std::end(result), std::greater<int>());
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Параллельное разбиение [left, right) на месте: в начало - элементы, для которых predicate истинен
+// Возвращает границу middle: [left, middle) - predicate истинен, [middle, right) - ложен.
+// Каждый поток разбивает свой блок (std::partition), затем элементы не на своей стороне границы
+// меняются местами парами: ложных слева от middle ровно столько же, сколько истинных справа.
+// Дополнительная память - O(threads) на описание интервалов, а не копия массива
+template <typename Predicate>
+std::size_t parallel_partition(std::vector<int> & vector, std::size_t left, std::size_t right,
+                               Predicate predicate, std::size_t threads)
+{
+    // Размер блока, который обрабатывает каждый поток
+    std::size_t chunk = (right - left + threads - 1) / threads;
+    auto block_begin = [&](std::size_t t) { return std::min(right, left + t * chunk); };
+    auto block_end = [&](std::size_t t) { return std::min(right, left + (t + 1) * chunk); };
+    // Запуск function(t) во всех потоках
+    auto run = [threads](auto && function)
+    {
+        std::vector<std::thread> workers;
+        for (auto t = 0uz; t < threads; ++t)
+            workers.emplace_back(function, t);
+        for (auto & worker : workers)
+            worker.join();
+    };
+
+    // Проход 1: каждый блок разбивается на месте, split[t] - его граница
+    std::vector<std::size_t> split(threads);
+    run([&](std::size_t t)
+    {
+        auto first = std::begin(vector) + block_begin(t), last = std::begin(vector) + block_end(t);
+        split[t] = std::partition(first, last, predicate) - std::begin(vector);
+    });
+    std::size_t middle = left;
+    for (auto t = 0uz; t < threads; ++t)
+        middle += split[t] - block_begin(t);
+
+    // Интервалы не на своей стороне: ложные части блоков левее middle и истинные правее middle
+    struct Interval
+    {
+        std::size_t begin, end;
+    };
+    std::vector<Interval> wrong_false, wrong_true;
+    for (auto t = 0uz; t < threads; ++t)
+    {
+        if (std::max(split[t], block_begin(t)) < std::min(block_end(t), middle))
+            wrong_false.push_back({ split[t], std::min(block_end(t), middle) });
+        if (std::max(block_begin(t), middle) < split[t])
+            wrong_true.push_back({ std::max(block_begin(t), middle), split[t] });
+    }
+    // Префиксные суммы длин: номер элемента -> интервал и смещение в нем
+    auto prefix = [](std::vector<Interval> const & intervals)
+    {
+        std::vector<std::size_t> sums = { 0 };
+        for (auto const & interval : intervals)
+            sums.push_back(sums.back() + (interval.end - interval.begin));
+        return sums;
+    };
+    std::vector<std::size_t> false_sums = prefix(wrong_false), true_sums = prefix(wrong_true);
+    std::size_t misplaced = false_sums.back();
+    assert(misplaced == true_sums.back());
+
+    // Проход 2: потоки делят пары для обмена поровну
+    run([&](std::size_t t)
+    {
+        std::size_t from = misplaced * t / threads, to = misplaced * (t + 1) / threads;
+        if (from == to)
+            return;
+        // Курсор по списку интервалов, начиная с элемента номер from
+        auto locate = [from](std::vector<std::size_t> const & sums, std::vector<Interval> const & intervals)
+        {
+            std::size_t index = std::upper_bound(std::begin(sums), std::end(sums), from) - std::begin(sums) - 1;
+            return std::pair{ index, intervals[index].begin + (from - sums[index]) };
+        };
+        auto [false_index, false_at] = locate(false_sums, wrong_false);
+        auto [true_index, true_at] = locate(true_sums, wrong_true);
+        for (auto j = from; j < to; ++j)
+        {
+            if (false_at == wrong_false[false_index].end)
+                false_at = wrong_false[++false_index].begin;
+            if (true_at == wrong_true[true_index].end)
+                true_at = wrong_true[++true_index].begin;
+            std::swap(vector[false_at++], vector[true_at++]);
+        }
+    });
+
+    return middle;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Параллельная версия nth_element для больших массивов
+// Пока интервал велик, сужаем его параллельным разбиением на месте, остаток - последовательный интроселект.
+// Разбиение двухпроходное: сначала "< pivot", и только если k не попало влево - "== pivot" среди остальных
+void parallel_nth_element(std::vector<int> & vector, std::size_t k,
+                          std::size_t threads = std::thread::hardware_concurrency())
+{
+    // Для пустого массива или позиции за его концом делать нечего
+    if (k >= std::size(vector))
+        return;
+
+    // Порог, ниже которого накладные расходы на потоки не окупаются
+    const auto threshold = 1uz << 20;
+    threads = std::max(threads, 1uz);
+    std::size_t left = 0, right = std::size(vector);
+
+    // Для небольших массивов или одного потока - последовательный вариант
+    if (right <= threshold || threads == 1)
+    {
+        select(vector, left, right, k);
+        return;
+    }
+
+    while (right - left > threshold)
+    {
+        // Опорный элемент - медиана трех, как в последовательной версии (он есть в интервале,
+        // поэтому каждый шаг сужает интервал хотя бы на один элемент)
+        int pivot = medianOfThree(vector, left, right);
+        std::size_t less = parallel_partition(vector, left, right, [pivot](int value) { return value < pivot; }, threads);
+        if (k < less)
+        {
+            right = less;
+            continue;
+        }
+        // Справа от less все элементы не меньше опорного: отделяем равные ему
+        std::size_t equal = parallel_partition(vector, less, right, [pivot](int value) { return value == pivot; }, threads);
+
+        // Позиция k попала в группу равных опорному - ответ найден
+        if (k < equal)
+            return;
+        left = equal;
+    }
+
+    // Досчитываем остаток последовательно
+    select(vector, left, right, k);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Упаковка ключа int в беззнаковое 32-битное число с сохранением порядка:
+// инвертируем знаковый бит, чтобы отрицательные числа оказались меньше положительных
+std::uint32_t biasKey(int key)
+{
+    return static_cast<std::uint32_t>(key) ^ 0x8000'0000u;
+}
+
+// Обратное преобразование упакованного ключа в int
+int unbiasKey(std::uint32_t bits)
+{
+    return static_cast<int>(bits ^ 0x8000'0000u);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Сортирующая перестановка: keys[result[0]] <= keys[result[1]] <= ...
+// Сортировка устойчива - равные ключи остаются в исходном порядке индексов
+std::vector<std::size_t> argsort(std::vector<int> const & keys)
+{
+    std::size_t size = std::size(keys);
+    std::vector<std::size_t> permutation(size);
+
+    if (size <= std::numeric_limits<std::uint32_t>::max())
+    {
+        // Ключ в старших 32 битах, индекс в младших: одно 64-битное слово на элемент,
+        // сравнение слов = сравнение по ключу, а при равенстве - по индексу (устойчивость)
+        std::vector<std::uint64_t> packed(size);
+        for (auto i = 0uz; i < size; ++i)
+        {
+            packed[i] = (std::uint64_t(biasKey(keys[i])) << 32) | i;
+        }
+        sort(packed);
+        for (auto i = 0uz; i < size; ++i)
+        {
+            permutation[i] = packed[i] & 0xFFFF'FFFFu;
+        }
+    }
+    else
+    {
+        // Индекс не помещается в 32 бита - сортируем пары (ключ, индекс)
+        std::vector<std::pair<int, std::size_t>> pairs(size);
+        for (auto i = 0uz; i < size; ++i)
+        {
+            pairs[i] = { keys[i], i };
+        }
+        sort(pairs);
+        for (auto i = 0uz; i < size; ++i)
+        {
+            permutation[i] = pairs[i].second;
+        }
+    }
+    return permutation;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Переупорядочивание столбца по перестановке: result[i] = column[permutation[i]]
+// Одну перестановку от argsort можно применить к любому числу столбцов
+template <typename T>
+std::vector<T> permute(std::vector<T> const & column, std::vector<std::size_t> const & permutation)
+{
+    std::vector<T> result;
+    result.reserve(std::size(permutation));
+    for (auto index : permutation)
+    {
+        result.push_back(column[index]);
+    }
+    return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Сортировка пар (ключ, значение) по ключу для int значений:
+// как в argsort, ключ и индекс упаковываются в одно 64-битное слово, поэтому сортируется
+// один плотный массив, ключи восстанавливаются из него же, а значения собираются по индексам
+// за один проход. Устойчива, как и общий вариант: при равных ключах сохраняется исходный порядок
+void sort_by_key(std::vector<int> & keys, std::vector<int> & values)
+{
+    assert(std::size(keys) == std::size(values));
+    std::size_t size = std::size(keys);
+
+    if (size > std::numeric_limits<std::uint32_t>::max())
+    {
+        // Индекс не помещается в 32 бита - общий путь через argsort
+        auto permutation = argsort(keys);
+        keys = permute(keys, permutation);
+        values = permute(values, permutation);
+        return;
+    }
+
+    std::vector<std::uint64_t> packed(size);
+    for (auto i = 0uz; i < size; ++i)
+    {
+        packed[i] = (std::uint64_t(biasKey(keys[i])) << 32) | i;
+    }
+    sort(packed);
+    std::vector<int> sorted_values(size);
+    for (auto i = 0uz; i < size; ++i)
+    {
+        keys[i] = unbiasKey(std::uint32_t(packed[i] >> 32));
+        sorted_values[i] = values[packed[i] & 0xFFFF'FFFFu];
+    }
+    values = std::move(sorted_values);
+}
+
+// Сортировка по ключу для произвольного типа значений: argsort + переупорядочивание.
+// Устойчива - значения с равными ключами сохраняют исходный порядок
+template <typename T>
+void sort_by_key(std::vector<int> & keys, std::vector<T> & values)
+{
+    assert(std::size(keys) == std::size(values));
+    auto permutation = argsort(keys);
+    keys = permute(keys, permutation);
+    values = permute(values, permutation);
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Бенчмарк: std::nth_element против nth_element и parallel_nth_element (поиск медианы)
+void benchmark(std::size_t size)
+{
+    // Случайные данные с фиксированным seed для воспроизводимости
+    std::mt19937 random_generator(42);
+    std::uniform_int_distribution<int> number_range(0, 1'000'000'000);
+    std::vector<int> source(size);
+    for (auto & value : source)
+        value = number_range(random_generator);
+
+    std::size_t k = size / 2;
+
+    // Измеряет время одного вызова на свежей копии данных
+    auto measure = [&](auto && function)
+    {
+        std::vector<int> vector = source;
+        auto begin = std::chrono::steady_clock::now();
+        function(vector);
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    double time_std = measure([&](std::vector<int> & vector) { std::nth_element(std::begin(vector), std::begin(vector) + k, std::end(vector)); });
+    double time_select = measure([&](std::vector<int> & vector) { nth_element(vector, k); });
+    double time_parallel = measure([&](std::vector<int> & vector) { parallel_nth_element(vector, k); });
+
+    std::cout << "size = " << size
+              << ": std::nth_element " << time_std << " ms"
+              << ", nth_element " << time_select << " ms"
+              << ", parallel_nth_element " << time_parallel << " ms" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
+// Бенчмарк: сортировка записей по ключу - std::sort массива структур
+// против sort_by_key и argsort + permute над отдельными столбцами
+void benchmark_by_key(std::size_t size)
+{
+    // Запись в формате массива структур (как обычно хранят данные без столбцов)
+    struct Record
+    {
+        int key;
+        int payload;
+    };
+
+    // Случайные данные с фиксированным seed для воспроизводимости
+    std::mt19937 random_generator(42);
+    std::uniform_int_distribution<int> number_range(-1'000'000'000, 1'000'000'000);
+    std::vector<int> keys(size), payloads(size);
+    std::vector<Record> records(size);
+    for (auto i = 0uz; i < size; ++i)
+    {
+        keys[i] = number_range(random_generator);
+        payloads[i] = number_range(random_generator);
+        records[i] = { keys[i], payloads[i] };
+    }
+
+    // Измеряет время одного вызова в миллисекундах
+    auto measure = [](auto && function)
+    {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    double time_std = measure([&] { std::sort(std::begin(records), std::end(records),
+                                              [](Record const & lhs, Record const & rhs) { return lhs.key < rhs.key; }); });
+    std::vector<int> keys_copy = keys, payloads_copy = payloads;
+    double time_by_key = measure([&] { sort_by_key(keys_copy, payloads_copy); });
+    double time_argsort = measure([&]
+    {
+        auto permutation = argsort(keys);
+        keys = permute(keys, permutation);
+        payloads = permute(payloads, permutation);
+    });
+
+    // Все три способа должны дать одинаковую последовательность ключей
+    for (auto i = 0uz; i < size; ++i)
+    {
+        assert(keys_copy[i] == records[i].key && keys[i] == records[i].key);
+    }
+
+    std::cout << "size = " << size
+              << ": std::sort(records) " << time_std << " ms"
+              << ", sort_by_key " << time_by_key << " ms"
+              << ", argsort + permute " << time_argsort << " ms" << std::endl;
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+
 // Функция main - тестирование реализации сортировки
-int main()
+int main(int argc, char ** argv)
 {
     // Размер тестового массива (1000 элементов)
     auto size = 1'000uz;  // uz - суффикс для std::size_t
@@ -160,6 +637,119 @@ int main()
     // Проверяем, что массив действительно отсортирован
     // Если assert сработает - программа аварийно завершится
     assert(std::ranges::is_sorted(vector));
+
+//  ---------------------------------------
+    // Проверяем выбор порядковых статистик на случайных данных с повторами
+    std::mt19937 random_generator(1);
+    std::uniform_int_distribution<int> number_range(0, 100);
+    std::vector<int> random(100'000);
+    for (auto & value : random)
+        value = number_range(random_generator);
+
+    std::vector<int> expected = random;
+    std::sort(std::begin(expected), std::end(expected));
+
+    for (auto k : { 0uz, 1uz, 17uz, 50'000uz, 99'999uz })
+    {
+        std::vector<int> copy = random;
+        nth_element(copy, k);
+        assert(copy[k] == expected[k]);
+        // Слева не больше, справа не меньше найденного элемента
+        assert(std::all_of(std::begin(copy), std::begin(copy) + k, [&](int x) { return x <= copy[k]; }));
+        assert(std::all_of(std::begin(copy) + k, std::end(copy), [&](int x) { return x >= copy[k]; }));
+
+        copy = random;
+        parallel_nth_element(copy, k, 4);
+        assert(copy[k] == expected[k]);
+    }
+
+    // Параллельная версия на массиве больше порога (с реальным параллельным разбиением)
+    std::vector<int> large(3'000'000);
+    for (auto & value : large)
+        value = number_range(random_generator);
+    std::vector<int> large_expected = large;
+    std::nth_element(std::begin(large_expected), std::begin(large_expected) + 1'234'567, std::end(large_expected));
+    parallel_nth_element(large, 1'234'567, 4);
+    assert(large[1'234'567] == large_expected[1'234'567]);
+    // Много повторов и число потоков, не делящее размер: проверка обмена элементов между блоками
+    std::uniform_int_distribution<int> few_values(0, 7);
+    for (auto & value : large)
+        value = few_values(random_generator);
+    large_expected = large;
+    std::sort(std::begin(large_expected), std::end(large_expected));
+    for (auto k : { 0uz, 1'234'567uz, 2'999'999uz })
+    {
+        std::vector<int> copy = large;
+        parallel_nth_element(copy, k, 3);
+        assert(copy[k] == large_expected[k]);
+        assert(std::all_of(std::begin(copy), std::begin(copy) + k, [&](int x) { return x <= copy[k]; }));
+        assert(std::all_of(std::begin(copy) + k, std::end(copy), [&](int x) { return x >= copy[k]; }));
+    }
+
+    // Частичная сортировка: первые k элементов совпадают с началом полной сортировки
+    std::vector<int> partial = random;
+    partial_sort(partial, 1'000);
+    assert(std::equal(std::begin(partial), std::begin(partial) + 1'000, std::begin(expected)));
+
+    // top_k: k наибольших по убыванию
+    auto top = top_k(random, 10);
+    assert(std::size(top) == 10);
+    assert(std::equal(std::begin(top), std::end(top), std::rbegin(expected)));
+    // Оба пути (куча при малом k, копия и выбор при большом) и крайние k
+    for (auto k : { 0uz, 1uz, 1'562uz, 1'563uz, 60'000uz, 100'000uz, 200'000uz })
+    {
+        auto found = top_k(random, k);
+        assert(std::size(found) == std::min(k, std::size(random)));
+        assert(std::equal(std::begin(found), std::end(found), std::rbegin(expected)));
+    }
+    assert(top_k(std::vector<int>{ 5, 5, 1, 5 }, 3) == std::vector<int>({ 5, 5, 5 }));
+//  ---------------------------------------
+
+//  ---------------------------------------
+    // argsort: перестановка сортирует ключи и устойчива при равных ключах
+    std::vector<int> keys = { 3, -1, 2, -1, 0, 3 };
+    auto permutation = argsort(keys);
+    assert((permutation == std::vector<std::size_t>{ 1, 3, 4, 2, 0, 5 }));
+
+    // Одна перестановка переупорядочивает сразу несколько столбцов
+    std::vector<double> weights = { 0.3, -0.1, 0.2, -0.11, 0.0, 0.33 };
+    auto sorted_weights = permute(weights, permutation);
+    assert((sorted_weights == std::vector<double>{ -0.1, -0.11, 0.0, 0.2, 0.3, 0.33 }));
+
+    // sort_by_key для int значений (упакованный вариант): устойчив, как и общий
+    std::vector<int> sort_keys = keys;
+    std::vector<int> payload = { 30, -10, 20, -11, 0, 31 };
+    sort_by_key(sort_keys, payload);
+    assert((sort_keys == std::vector<int>{ -1, -1, 0, 2, 3, 3 }));
+    assert((payload == std::vector<int>{ -10, -11, 0, 20, 30, 31 }));
+    {
+        // Много равных ключей: int и общий варианты дают одинаковый результат
+        std::mt19937 tie_generator(5);
+        std::vector<int> tie_keys(10'000), tie_values(10'000);
+        for (auto & key : tie_keys) key = int(tie_generator() % 50) - 25;
+        for (auto & value : tie_values) value = int(tie_generator());
+        std::vector<int> generic_keys = tie_keys;
+        std::vector<long long> generic_values(std::begin(tie_values), std::end(tie_values));
+        sort_by_key(tie_keys, tie_values);
+        sort_by_key(generic_keys, generic_values);
+        assert(tie_keys == generic_keys);
+        assert(std::equal(std::begin(tie_values), std::end(tie_values), std::begin(generic_values)));
+    }
+
+    // sort_by_key для произвольных значений (через argsort)
+    std::vector<int> string_keys = { 2, 1, 2 };
+    std::vector<std::string> names = { "c", "a", "d" };
+    sort_by_key(string_keys, names);
+    assert((names == std::vector<std::string>{ "a", "c", "d" }));
+//  ---------------------------------------
+
+    // Бенчмарк: размеры от 1e3 до максимального (по умолчанию 1e7, до 1e9 через аргумент)
+    std::size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000uz;
+    for (auto size = 1'000uz; size <= max_size; size *= 10)
+    {
+        benchmark(size);
+        benchmark_by_key(size);
+    }
     
     // Возвращаем 0 (успешное завершение программы)
     return 0;
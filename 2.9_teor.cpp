@@ -5,6 +5,19 @@
 #include <random>        // Для генерации случайных чисел
 #include <chrono>        // Для работы со временем (измерение производительности)
 #include <cassert>       // Для макроса assert (проверка условий)
+#include <bit>           // Для std::countr_zero (подсчет младших нулевых битов)
+#include <cstdint>       // Для целочисленных типов фиксированного размера
+#include <cstddef>       // Для std::size_t
+#include <utility>       // Для std::pair (пары в тестах)
+#include <vector>        // Для std::vector (массивы пар в бенчмарке)
+#include <algorithm>     // Для std::min, std::max
+#include <atomic>        // Для std::atomic (флаг досрочной остановки редукции)
+#include <limits>        // Для std::numeric_limits (насыщение при переполнении)
+#include <optional>      // Для std::optional (НОК с проверкой переполнения)
+#include <thread>        // Для std::thread (параллельные редукции)
+#if defined(__AVX2__)
+#include <immintrin.h>   // Для AVX2-интринсиков (пакетный НОД)
+#endif
 
 // Рекурсивная функция вычисления наибольшего общего делителя (НОД)
 int findGCDRecursive(int first, int second) {
@@ -34,6 +47,157 @@ int findGCDIterative(int first, int second) {
     return first;
 }
 
+// Подсчет младших нулевых битов (ctz) - одна инструкция tzcnt/bsf вместо деления
+inline int countTrailingZeros(std::uint32_t value) { return std::countr_zero(value); }
+inline int countTrailingZeros(std::uint64_t value) { return std::countr_zero(value); }
+// Для 128-битных чисел: ctz младшей половины, а если она нулевая - 64 + ctz старшей
+inline int countTrailingZeros(unsigned __int128 value) {
+    auto low = static_cast<std::uint64_t>(value);
+    return low != 0 ? std::countr_zero(low) : 64 + std::countr_zero(static_cast<std::uint64_t>(value >> 64));
+}
+
+// Бинарный алгоритм Евклида (алгоритм Стейна) для беззнаковых 32/64/128-битных чисел
+// Вместо взятия остатка (самая медленная целочисленная операция) использует
+// только сдвиги, вычитание и подсчет младших нулевых битов.
+// Шаг без ветвлений: min и |a - b| выбираются маской из сравнения, а ctz считается по разности
+// параллельно с ними, поэтому на случайных входах нет ошибок предсказания переходов
+// (тернарный оператор GCC 12 компилирует здесь в условный переход, а не в cmov)
+template <typename T>
+T findGCDBinary(T first, T second) {
+    // НОД(0, b) = b, НОД(a, 0) = a
+    if (first == 0) return second;
+    if (second == 0) return first;
+    int firstZeros = countTrailingZeros(first);
+    int secondZeros = countTrailingZeros(second);
+    // Общая степень двойки: min(ctz(a), ctz(b))
+    int shift = std::min(firstZeros, secondZeros);
+    // Второе число делаем нечетным - двойки в нем уже не влияют на ответ
+    second >>= secondZeros;
+    while (first != 0) {
+        // Убираем из первого числа множители 2 (второе нечетно, НОД не меняется)
+        first >>= firstZeros;
+        // НОД(a, b) = НОД(min(a, b), |a - b|); ctz(b - a) = ctz(|a - b|) и в беззнаковой арифметике
+        T difference = second - first;
+        firstZeros = countTrailingZeros(difference);
+        T mask = -static_cast<T>(first > second);  // Все единицы, если a > b
+        second -= difference & ~mask;              // min(a, b): b - (b - a) = a или b
+        first = (difference ^ mask) - mask;        // |a - b|: при a > b - отрицание разности
+    }
+    // Возвращаем общую степень двойки на место
+    return second << shift;
+}
+
+// Пакетный НОД для массивов пар 32-битных чисел: result[i] = НОД(first[i], second[i])
+// При сборке с AVX2 обрабатывает 8 пар одновременно в SIMD-регистре, каждая пара
+// в своей дорожке (lane); хвост массива и сборка без AVX2 - скалярный findGCDBinary
+void findGCDBatch(const std::uint32_t* first, const std::uint32_t* second,
+                  std::uint32_t* result, std::size_t count) {
+    std::size_t index = 0;
+#if defined(__AVX2__)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i exponentMask = _mm256_set1_epi32(0xFF);
+    const __m256i exponentBias = _mm256_set1_epi32(127);
+    // ctz в каждой дорожке: выделяем младший бит (x & -x), переводим его в float
+    // и читаем показатель степени. Для x = 0 получается отрицательный сдвиг,
+    // который _mm256_srlv_epi32 трактует как большой и дает 0
+    auto ctz = [&](__m256i x) {
+        __m256i lowest = _mm256_and_si256(x, _mm256_sub_epi32(zero, x));
+        __m256i bits = _mm256_castps_si256(_mm256_cvtepi32_ps(lowest));
+        __m256i exponent = _mm256_and_si256(_mm256_srli_epi32(bits, 23), exponentMask);
+        return _mm256_sub_epi32(exponent, exponentBias);
+    };
+    // Поразрядный выбор по маске: mask ? yes : no через and/andnot/or.
+    // Маски сравнений заполняют дорожку целиком, поэтому побитового выбора достаточно
+    auto select = [](__m256i mask, __m256i yes, __m256i no) {
+        return _mm256_or_si256(_mm256_and_si256(mask, yes), _mm256_andnot_si256(mask, no));
+    };
+    for (; index + 8 <= count; index += 8) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + index));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(second + index));
+        // Дорожки с нулем: ответ равен другому числу (a | b), итерации не нужны
+        __m256i zeroLane = _mm256_or_si256(_mm256_cmpeq_epi32(a, zero), _mm256_cmpeq_epi32(b, zero));
+        __m256i trivial = _mm256_or_si256(a, b);
+        // Общая степень двойки
+        __m256i shift = ctz(trivial);
+        // В нулевых дорожках подставляем (1, 0): цикл для них сразу завершен
+        a = select(zeroLane, _mm256_set1_epi32(1), a);
+        b = _mm256_andnot_si256(zeroLane, b);
+        a = _mm256_srlv_epi32(a, ctz(a));
+        // Цикл Стейна, пока хотя бы в одной дорожке b != 0
+        while (!_mm256_testz_si256(b, b)) {
+            // Активные дорожки - те, где b еще не обнулилось
+            __m256i active = _mm256_xor_si256(_mm256_cmpeq_epi32(b, zero), _mm256_set1_epi32(-1));
+            b = _mm256_srlv_epi32(b, ctz(b));
+            __m256i low = _mm256_min_epu32(a, b);
+            __m256i high = _mm256_max_epu32(a, b);
+            // В завершенных дорожках a не трогаем (иначе min(a, 0) испортит ответ)
+            a = select(active, low, a);
+            b = _mm256_sub_epi32(high, low);
+            b = _mm256_and_si256(b, active);
+        }
+        __m256i gcd = _mm256_sllv_epi32(a, shift);
+        gcd = select(zeroLane, trivial, gcd);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), gcd);
+    }
+#endif
+    // Скалярный хвост (или весь массив без AVX2)
+    for (; index < count; ++index) {
+        result[index] = findGCDBinary(first[index], second[index]);
+    }
+}
+
+// Пакетный НОД для массивов пар 64-битных чисел
+// В AVX2 нет беззнаковых 64-битных min/max, поэтому пары обрабатываются
+// скалярным findGCDBinary; независимые итерации процессор выполняет с перекрытием
+void findGCDBatch(const std::uint64_t* first, const std::uint64_t* second,
+                  std::uint64_t* result, std::size_t count) {
+    for (std::size_t index = 0; index < count; ++index) {
+        result[index] = findGCDBinary(first[index], second[index]);
+    }
+}
+
+// Бенчмарк НОД: Евклид (рекурсивный и итеративный), std::gcd, бинарный и пакетный
+// На вход - массивы пар; выводит время в наносекундах на одну пару
+void benchmarkGCD(const char* title, const std::vector<std::uint32_t>& first,
+                  const std::vector<std::uint32_t>& second) {
+    std::size_t count = first.size();
+    std::vector<std::uint32_t> result(count);
+    // Сумма результатов не дает компилятору выбросить вычисления
+    std::uint64_t checksum = 0;
+
+    // Измеряет время прохода по всем парам в наносекундах на пару
+    auto measure = [&](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - begin).count() / count;
+    };
+
+    double recursiveTime = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) checksum += findGCDRecursive(first[i], second[i]);
+    });
+    double iterativeTime = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) checksum += findGCDIterative(first[i], second[i]);
+    });
+    double standardTime = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) checksum += std::gcd(first[i], second[i]);
+    });
+    double binaryTime = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) checksum += findGCDBinary(first[i], second[i]);
+    });
+    double batchTime = measure([&] {
+        findGCDBatch(first.data(), second.data(), result.data(), count);
+    });
+    for (std::size_t i = 0; i < count; ++i) checksum += result[i];
+
+    std::cout << title << " (ns/pair): recursive " << recursiveTime
+              << ", iterative " << iterativeTime
+              << ", std::gcd " << standardTime
+              << ", binary " << binaryTime
+              << ", batch " << batchTime
+              << " [checksum " << checksum << "]" << std::endl;
+}
+
 // Функция вычисления наименьшего общего кратного (НОК)
 int findLCM(int first, int second) {
     // Если любое из чисел равно 0, НОК равен 0
@@ -41,12 +205,325 @@ int findLCM(int first, int second) {
         return 0;
     // Вычисляем НОД с помощью итеративной функции
     int gcd_result = findGCDIterative(first, second);
-    // Формула: НОК(a, b) = |a * b| / НОД(a, b)
-    return std::abs(first * second) / gcd_result;
+    // Формула: НОК(a, b) = |a / НОД(a, b) * b|
+    // Сначала делим, потом умножаем: произведение a * b переполняет int раньше самого НОК
+    return std::abs(first / gcd_result * second);
+}
+
+// НОК 64-битных чисел в 128-битном результате - переполнение невозможно,
+// так как a / НОД(a, b) * b <= a * b < 2^128
+unsigned __int128 findLCMWide(std::uint64_t first, std::uint64_t second) {
+    if (first == 0 || second == 0)
+        return 0;
+    return static_cast<unsigned __int128>(first / findGCDBinary(first, second)) * second;
+}
+
+// НОК с проверкой переполнения для беззнаковых 32/64/128-битных чисел
+// Возвращает пустой std::optional, если НОК не помещается в тип T
+template <typename T>
+std::optional<T> findLCMChecked(T first, T second) {
+    if (first == 0 || second == 0)
+        return T(0);
+    T result;
+    // Делим до умножения, а само умножение проверяем встроенной функцией компилятора
+    if (__builtin_mul_overflow(first / findGCDBinary(first, second), second, &result))
+        return std::nullopt;
+    return result;
+}
+
+// НОК с насыщением: при переполнении возвращает максимальное значение типа T
+template <typename T>
+T findLCMSaturating(T first, T second) {
+    auto result = findLCMChecked(first, second);
+    return result ? *result : std::numeric_limits<T>::max();
+}
+
+// Разбиение массива на блоки для потоков и сбор частичных результатов деревом:
+// на каждом уровне соседние результаты попарно объединяются функцией combine
+template <typename T, typename Combine>
+T treeCombine(std::vector<T> partial, Combine combine) {
+    for (std::size_t step = 1; step < partial.size(); step *= 2) {
+        for (std::size_t i = 0; i + step < partial.size(); i += 2 * step) {
+            partial[i] = combine(partial[i], partial[i + step]);
+        }
+    }
+    return partial.empty() ? T{} : partial[0];
+}
+
+// Параллельный НОД всех элементов массива (НОД пустого массива равен 0)
+// Каждый поток сворачивает свой блок, результаты объединяются деревом.
+// Как только в любом блоке НОД стал 1, общий ответ известен - все потоки останавливаются
+std::uint64_t gcd_reduce(const std::vector<std::uint64_t>& values,
+                         unsigned threads = std::thread::hardware_concurrency()) {
+    threads = std::max(threads, 1u);
+    std::size_t chunk = (values.size() + threads - 1) / threads;
+    std::vector<std::uint64_t> partial(threads, 0);
+    std::atomic<bool> reachedOne{false};
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::size_t begin = std::min(values.size(), t * chunk);
+            std::size_t end = std::min(values.size(), begin + chunk);
+            std::uint64_t gcd = 0;
+            for (std::size_t i = begin; i < end; ++i) {
+                gcd = findGCDBinary(gcd, values[i]);
+                if (gcd == 1) {
+                    reachedOne.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                // Флаг проверяем раз в 1024 элемента, чтобы не нагружать общую кэш-линию
+                if ((i & 1023) == 0 && reachedOne.load(std::memory_order_relaxed))
+                    break;
+            }
+            partial[t] = gcd;
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    if (reachedOne.load()) return 1;
+    return treeCombine(partial, [](std::uint64_t lhs, std::uint64_t rhs) { return findGCDBinary(lhs, rhs); });
+}
+
+// Параллельный НОК всех элементов массива с проверкой переполнения (НОК пустого массива равен 1)
+// Возвращает пустой std::optional, если НОК не помещается в 64 бита.
+// Ноль в массиве останавливает все потоки; после переполнения потоки не считают НОК,
+// а только проверяют остаток своего блока на нули, поэтому результат не зависит от числа потоков
+std::optional<std::uint64_t> lcm_reduce(const std::vector<std::uint64_t>& values,
+                                        unsigned threads = std::thread::hardware_concurrency()) {
+    threads = std::max(threads, 1u);
+    std::size_t chunk = (values.size() + threads - 1) / threads;
+    std::vector<std::optional<std::uint64_t>> partial(threads, std::uint64_t(1));
+    std::atomic<bool> overflow{false}, reachedZero{false};
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::size_t begin = std::min(values.size(), t * chunk);
+            std::size_t end = std::min(values.size(), begin + chunk);
+            std::uint64_t lcm = 1;
+            for (std::size_t i = begin; i < end; ++i) {
+                if (values[i] == 0) {
+                    reachedZero.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                auto next = findLCMChecked(lcm, values[i]);
+                if (next) lcm = *next;
+                else overflow.store(true, std::memory_order_relaxed);
+                // Флаги проверяем раз в 1024 элемента, чтобы не нагружать общую кэш-линию
+                if (!next || ((i & 1023) == 0 && overflow.load(std::memory_order_relaxed))) {
+                    // НОК уже не помещается в 64 бита: ответ зависит только от наличия нуля
+                    if (std::find(values.begin() + i + 1, values.begin() + end, 0) != values.begin() + end)
+                        reachedZero.store(true, std::memory_order_relaxed);
+                    break;
+                }
+                if ((i & 1023) == 0 && reachedZero.load(std::memory_order_relaxed))
+                    break;
+            }
+            partial[t] = lcm;
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    // Ноль в массиве дает НОК 0 независимо от переполнения в других блоках
+    if (reachedZero.load()) return std::uint64_t(0);
+    if (overflow.load()) return std::nullopt;
+    return treeCombine(partial, [](std::optional<std::uint64_t> lhs, std::optional<std::uint64_t> rhs)
+                                    -> std::optional<std::uint64_t> {
+        if (!lhs || !rhs) return std::nullopt;
+        return findLCMChecked(*lhs, *rhs);
+    });
+}
+
+// Результат расширенного алгоритма Евклида: first * x + second * y = gcd (коэффициенты Безу)
+// Коэффициенты хранятся в 128 битах: для 64-битных входов они не превышают их по модулю
+struct ExtendedGCD {
+    std::uint64_t gcd;
+    __int128 x, y;
+};
+
+// Расширенный бинарный алгоритм Евклида для 64-битных чисел
+// Как и findGCDBinary, обходится без деления: только сдвиги, вычитания и сложения
+ExtendedGCD findExtendedGCDBinary(std::uint64_t first, std::uint64_t second) {
+    // Крайние случаи: НОД(a, 0) = a = a * 1 + 0 * 0
+    if (second == 0) return {first, 1, 0};
+    if (first == 0) return {second, 0, 1};
+    // Выносим общую степень двойки - она войдет в НОД
+    int shift = countTrailingZeros(first | second);
+    __int128 a = first >> shift, b = second >> shift;
+    // Инвариант: u = A * a + B * b, v = C * a + D * b
+    __int128 u = a, v = b;
+    __int128 A = 1, B = 0, C = 0, D = 1;
+    while (u != 0) {
+        // Делим u на 2, поддерживая инвариант (при нечетных A или B сдвигаем их на (b, -a))
+        while ((u & 1) == 0) {
+            u >>= 1;
+            if ((A & 1) == 0 && (B & 1) == 0) {
+                A >>= 1;
+                B >>= 1;
+            } else {
+                A = (A + b) >> 1;
+                B = (B - a) >> 1;
+            }
+        }
+        // То же самое для v
+        while ((v & 1) == 0) {
+            v >>= 1;
+            if ((C & 1) == 0 && (D & 1) == 0) {
+                C >>= 1;
+                D >>= 1;
+            } else {
+                C = (C + b) >> 1;
+                D = (D - a) >> 1;
+            }
+        }
+        // Вычитаем меньшее из большего вместе с коэффициентами
+        if (u >= v) {
+            u -= v;
+            A -= C;
+            B -= D;
+        } else {
+            v -= u;
+            C -= A;
+            D -= B;
+        }
+    }
+    // u обнулилось: v = НОД(a, b), коэффициенты - C и D
+    return {static_cast<std::uint64_t>(v) << shift, C, D};
+}
+
+// Умножение по модулю через 128-битное произведение
+inline std::uint64_t mulMod(std::uint64_t first, std::uint64_t second, std::uint64_t modulus) {
+    return static_cast<std::uint64_t>(static_cast<unsigned __int128>(first) * second % modulus);
+}
+
+// Обратный элемент по модулю: value * inverse = 1 (mod modulus)
+// Возвращает пустой std::optional, если НОД(value, modulus) != 1
+std::optional<std::uint64_t> findModInverse(std::uint64_t value, std::uint64_t modulus) {
+    if (modulus == 0) return std::nullopt;
+    auto [gcd, x, y] = findExtendedGCDBinary(value % modulus, modulus);
+    if (gcd != 1) return modulus == 1 ? std::optional<std::uint64_t>(0) : std::nullopt;
+    // Приводим коэффициент x к диапазону [0, modulus)
+    __int128 inverse = x % static_cast<__int128>(modulus);
+    if (inverse < 0) inverse += modulus;
+    return static_cast<std::uint64_t>(inverse);
+}
+
+// Пакетное обращение по модулю трюком Монтгомери: вместо n обращений -
+// одно обращение и около 3n умножений. Массив делится на блоки по потокам,
+// каждый поток обращает свой блок (одно обращение на поток).
+// Возвращает пустой std::optional, если хотя бы один элемент необратим
+std::optional<std::vector<std::uint64_t>> findModInverseBatch(const std::vector<std::uint64_t>& values,
+                                                              std::uint64_t modulus,
+                                                              unsigned threads = std::thread::hardware_concurrency()) {
+    threads = std::max(threads, 1u);
+    std::size_t chunk = (values.size() + threads - 1) / threads;
+    std::vector<std::uint64_t> result(values.size());
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::size_t begin = std::min(values.size(), t * chunk);
+            std::size_t end = std::min(values.size(), begin + chunk);
+            if (begin == end) return;
+            // Прямой проход: result[i] = values[begin] * ... * values[i] (префиксные произведения)
+            std::uint64_t product = 1 % modulus;
+            for (std::size_t i = begin; i < end; ++i) {
+                product = mulMod(product, values[i] % modulus, modulus);
+                result[i] = product;
+            }
+            // Единственное обращение - произведения всего блока
+            auto inverse = findModInverse(product, modulus);
+            if (!inverse) {
+                failed.store(true, std::memory_order_relaxed);
+                return;
+            }
+            // Обратный проход: inv(values[i]) = inv(prefix[i]) * prefix[i - 1],
+            // затем inv(prefix[i - 1]) = inv(prefix[i]) * values[i]
+            std::uint64_t running = *inverse;
+            for (std::size_t i = end - 1; i > begin; --i) {
+                std::uint64_t previous = result[i - 1];
+                result[i] = mulMod(running, previous, modulus);
+                running = mulMod(running, values[i] % modulus, modulus);
+            }
+            result[begin] = running;
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    if (failed.load()) return std::nullopt;
+    return result;
+}
+
+// Бенчмарк обращения по модулю простого 2^61 - 1: обращений в секунду (в миллионах)
+void benchmarkInverse(std::size_t count, std::mt19937& random_generator) {
+    const std::uint64_t modulus = (1ull << 61) - 1;
+    std::uniform_int_distribution<std::uint64_t> value_range(1, modulus - 1);
+    std::vector<std::uint64_t> values(count);
+    for (auto& value : values) value = value_range(random_generator);
+
+    // Измеряет пропускную способность в миллионах обращений в секунду
+    auto measure = [&](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return count / std::chrono::duration<double, std::micro>(end - begin).count();
+    };
+
+    std::uint64_t checksum = 0;
+    double single = measure([&] {
+        for (auto value : values) checksum += findModInverse(value, modulus).value_or(0);
+    });
+    double batchSequential = measure([&] { checksum += (*findModInverseBatch(values, modulus, 1))[0]; });
+    double batchParallel = measure([&] { checksum += (*findModInverseBatch(values, modulus))[0]; });
+
+    std::cout << "inverse " << count << " values (M inverses/s): one by one " << single
+              << ", batch 1 thread " << batchSequential
+              << ", batch all threads " << batchParallel
+              << " [checksum " << checksum << "]" << std::endl;
+}
+
+// Бенчмарк редукций: пропускная способность в миллионах элементов в секунду
+void benchmarkReduce(std::size_t count, std::mt19937& random_generator) {
+    // Все элементы кратны 7 * 11 * 13 - НОД не достигает 1, нужен полный проход
+    std::uniform_int_distribution<std::uint64_t> factor_range(1, 1'000'000'000);
+    std::vector<std::uint64_t> multiples(count);
+    for (auto& value : multiples) value = 1001 * factor_range(random_generator);
+
+    // Делители числа 2^20 * 3^12 * 5^8 - НОК не переполняет 64 бита
+    std::uniform_int_distribution<int> power2(0, 20), power3(0, 12), power5(0, 8);
+    std::vector<std::uint64_t> divisors(count);
+    for (auto& value : divisors) {
+        value = 1;
+        for (int i = power2(random_generator); i > 0; --i) value *= 2;
+        for (int i = power3(random_generator); i > 0; --i) value *= 3;
+        for (int i = power5(random_generator); i > 0; --i) value *= 5;
+    }
+
+    // Измеряет пропускную способность в миллионах элементов в секунду
+    auto measure = [&](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return count / std::chrono::duration<double, std::micro>(end - begin).count();
+    };
+
+    std::uint64_t checksum = 0;
+    double sequentialGCD = measure([&] { checksum += gcd_reduce(multiples, 1); });
+    double parallelGCD = measure([&] { checksum += gcd_reduce(multiples); });
+    double sequentialLCM = measure([&] { checksum += lcm_reduce(divisors, 1).value_or(0); });
+    double parallelLCM = measure([&] { checksum += lcm_reduce(divisors).value_or(0); });
+
+    std::cout << "reduce " << count << " values (M values/s): gcd_reduce 1 thread " << sequentialGCD
+              << ", all threads " << parallelGCD
+              << "; lcm_reduce 1 thread " << sequentialLCM
+              << ", all threads " << parallelLCM
+              << " [checksum " << checksum << "]" << std::endl;
 }
 
 // Главная функция программы
-int main() {
+int main(int argc, char** argv) {
     // Получаем текущее время для инициализации генератора случайных чисел
     auto time_point = std::chrono::steady_clock::now();
     // Преобразуем время в числовое значение (seed)
@@ -85,6 +562,32 @@ int main() {
     // Кастомная и стандартная реализации НОК должны совпадать
     assert(lcm_custom == lcm_standard);
     
+    // Бинарный НОД совпадает со стандартным для 32, 64 и 128-битных чисел
+    assert(findGCDBinary<std::uint32_t>(num1, num2) == static_cast<std::uint32_t>(gcd_standard));
+    assert(findGCDBinary<std::uint64_t>(0, 7) == 7 && findGCDBinary<std::uint64_t>(7, 0) == 7);
+    assert(findGCDBinary<std::uint64_t>(0, 0) == 0);
+    assert(findGCDBinary<std::uint64_t>(1ull << 40, 3ull << 36) == 1ull << 36);
+    assert(findGCDBinary<std::uint64_t>(12200160415121876738ull, 7540113804746346429ull) == 1);  // Соседние числа Фибоначчи
+    unsigned __int128 big = static_cast<unsigned __int128>(1) << 100;
+    assert(findGCDBinary(big * 3, big * 5 / 4) == big / 4);
+
+    // Пакетный НОД совпадает с std::gcd на случайных парах, включая нули и степени двойки
+    std::uniform_int_distribution<std::uint32_t> wide_range(0, 0xFFFFFFFFu);
+    std::vector<std::uint32_t> batch_first(1003), batch_second(1003), batch_result(1003);
+    for (std::size_t i = 0; i < batch_first.size(); ++i) {
+        batch_first[i] = wide_range(random_generator) >> (i % 32);
+        batch_second[i] = wide_range(random_generator) >> ((i * 7) % 32);
+    }
+    batch_first[0] = 0;
+    batch_second[1] = 0;
+    batch_first[2] = batch_second[2] = 0;
+    batch_first[3] = 0x80000000u;
+    batch_second[3] = 0xC0000000u;
+    findGCDBatch(batch_first.data(), batch_second.data(), batch_result.data(), batch_first.size());
+    for (std::size_t i = 0; i < batch_first.size(); ++i) {
+        assert(batch_result[i] == std::gcd(batch_first[i], batch_second[i]));
+    }
+
     // Выводим результаты вычислений
     std::cout << "Calculation results:" << std::endl;
     // Выводим НОД (можно использовать любой из результатов, они одинаковы)
@@ -92,6 +595,84 @@ int main() {
     // Выводим НОК
     std::cout << "LCM = " << lcm_custom << std::endl;
     
+    // НОК делит до умножения: 46340 * 46341 не помещается в int, а НОК(2 * 46340, 46340) помещается
+    assert(findLCM(2 * 46340, 46340) == 2 * 46340);
+    assert(findLCM(-4, 6) == 12);
+
+    // 64-битный НОК в 128-битном результате и варианты с проверкой и насыщением
+    std::uint64_t max64 = std::numeric_limits<std::uint64_t>::max();
+    assert(findLCMWide(max64, max64 - 1) == static_cast<unsigned __int128>(max64) * (max64 - 1));
+    assert(findLCMChecked<std::uint64_t>(1ull << 40, 1ull << 50) == 1ull << 50);
+    assert(!findLCMChecked<std::uint64_t>(max64, max64 - 1));
+    assert(findLCMSaturating<std::uint64_t>(max64, max64 - 1) == max64);
+    assert(findLCMChecked<unsigned __int128>(max64, max64 - 1) == findLCMWide(max64, max64 - 1));
+
+    // Параллельные редукции: совпадают с последовательной сверткой std::gcd / std::lcm
+    std::vector<std::uint64_t> reduce_values(100'000);
+    for (auto& value : reduce_values) value = 6 * 35 * static_cast<std::uint64_t>(number_range(random_generator));
+    std::uint64_t expected_gcd = 0;
+    for (auto value : reduce_values) expected_gcd = std::gcd(expected_gcd, value);
+    assert(gcd_reduce(reduce_values, 4) == expected_gcd);
+    assert(gcd_reduce({}, 4) == 0);
+    reduce_values[77'777] = 1;  // После появления единицы НОД равен 1
+    assert(gcd_reduce(reduce_values, 4) == 1);
+
+    std::vector<std::uint64_t> small_values = { 4, 6, 10, 9, 7, 8, 14, 15 };
+    assert(lcm_reduce(small_values, 3) == 2520);
+    assert(lcm_reduce({}, 3) == 1);
+    small_values.push_back(0);
+    assert(lcm_reduce(small_values, 3) == 0);
+    std::vector<std::uint64_t> primes = { 1'000'000'007, 998'244'353, 1'000'000'009 };
+    assert(!lcm_reduce(primes, 2));  // Произведение трех простых около 1e27 не помещается в 64 бита
+    primes.insert(primes.end(), { 5, 0 });  // Ноль после переполнения: НОК 0 при любом числе потоков
+    for (unsigned threads = 1; threads <= 5; ++threads) assert(lcm_reduce(primes, threads) == 0);
+
+    // Расширенный НОД: коэффициенты Безу удовлетворяют first * x + second * y = gcd
+    for (auto [a, b] : { std::pair<std::uint64_t, std::uint64_t>{240, 46}, {46, 240}, {0, 5}, {5, 0},
+                         {1ull << 63, 1ull << 20}, {12200160415121876738ull, 7540113804746346429ull},
+                         {0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFEull} }) {
+        auto [gcd, x, y] = findExtendedGCDBinary(a, b);
+        assert(gcd == std::gcd(a, b));
+        assert(static_cast<__int128>(a) * x + static_cast<__int128>(b) * y == static_cast<__int128>(gcd));
+    }
+
+    // Обратный элемент: 3 * 7 = 21 = 1 (mod 10); у 4 по модулю 10 обратного нет
+    assert(findModInverse(3, 10) == 7);
+    assert(!findModInverse(4, 10));
+
+    // Пакетное обращение совпадает с поэлементным
+    const std::uint64_t prime = 1'000'000'007;
+    std::vector<std::uint64_t> inverse_values(10'001);
+    for (std::size_t i = 0; i < inverse_values.size(); ++i) inverse_values[i] = i + 1;
+    auto inverses = findModInverseBatch(inverse_values, prime, 4);
+    assert(inverses);
+    for (std::size_t i = 0; i < inverse_values.size(); ++i) {
+        assert((*inverses)[i] == findModInverse(inverse_values[i], prime));
+        assert(mulMod((*inverses)[i], inverse_values[i], prime) == 1);
+    }
+    inverse_values[5'000] = prime;  // Ноль по модулю - необратим
+    assert(!findModInverseBatch(inverse_values, prime, 4));
+
+    // Бенчмарк: число пар задается аргументом командной строки (по умолчанию 1e6)
+    std::size_t pairs = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    std::uniform_int_distribution<std::uint32_t> positive_range(1, 0x7FFFFFFFu);
+    std::vector<std::uint32_t> random_first(pairs), random_second(pairs);
+    for (std::size_t i = 0; i < pairs; ++i) {
+        random_first[i] = positive_range(random_generator);
+        random_second[i] = positive_range(random_generator);
+    }
+    benchmarkGCD("random", random_first, random_second);
+
+    // Худший случай Евклида - соседние числа Фибоначчи F(46), F(45)
+    std::vector<std::uint32_t> fibonacci_first(pairs, 1836311903u), fibonacci_second(pairs, 1134903170u);
+    benchmarkGCD("fibonacci", fibonacci_first, fibonacci_second);
+
+    // Бенчмарк редукций на том же числе элементов
+    benchmarkReduce(pairs, random_generator);
+
+    // Бенчмарк обращения по модулю
+    benchmarkInverse(pairs, random_generator);
+
     // Возвращаем 0 - признак успешного завершения программы
     return 0;
 }
\ No newline at end of file
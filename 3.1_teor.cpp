@@ -3,6 +3,18 @@
 #include <iostream>  // Для ввода-вывода (std::cout, std::endl)
 #include <cassert>   // Для макроса assert (проверка условий)
 #include <algorithm> // Для алгоритмов std::max и std::min
+#include <chrono>    // Для измерения времени в бенчмарке
+#include <cmath>     // Для std::sqrt, std::ceil (параметры упаковки STR и сетки)
+#include <cstddef>   // Для std::size_t
+#include <cstdlib>   // Для std::strtoull (разбор аргументов командной строки)
+#include <limits>    // Для std::numeric_limits (начальные значения min/max)
+#include <optional>  // Для std::optional (отложенное построение индексов в бенчмарке)
+#include <random>    // Для генерации случайных прямоугольников
+#include <thread>    // Для std::thread (многопоточные редукции)
+#include <utility>   // Для std::pair (пары пересекающихся прямоугольников)
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h> // Для SIMD-интринсиков (AVX2 / AVX-512)
+#endif
 
 // Структура для представления прямоугольника
 struct Rectangle {
@@ -16,8 +28,18 @@ struct Rectangle {
         : topLeftX(x1), topLeftY(y1), bottomRightX(x2), bottomRightY(y2) {}
 };
 
+// Площадь по ширине и высоте (обе неотрицательны и меньше 2^32).
+// Результат знаковый, потому что calculateIntersectionArea возвращает -1 при отсутствии пересечения.
+// Поэтому площадь должна быть меньше 2^63, и при координатах в [-2^30, 2^30] это выполняется всегда.
+// Для полного диапазона int она может достигать (2^32 - 1)^2 и не помещается в long long
+inline long long boxArea(long long width, long long height) {
+    assert(height == 0 || width <= std::numeric_limits<long long>::max() / height);
+    return width * height;
+}
+
 // Функция вычисления площади пересечения нескольких прямоугольников
-int calculateIntersectionArea(const std::vector<Rectangle>& rectangles) {
+// Площадь считается в 64 битах (ограничения - у boxArea): width * height переполняет int уже при сторонах около 46341
+long long calculateIntersectionArea(const std::vector<Rectangle>& rectangles) {
     // Если список прямоугольников пуст, возвращаем -1 (ошибка)
     if (rectangles.empty()) return -1;
     
@@ -50,11 +72,11 @@ int calculateIntersectionArea(const std::vector<Rectangle>& rectangles) {
         return 0; // Площадь пересечения равна 0 (касание по границе)
     }
 
-    // Вычисляем ширину и высоту области пересечения
-    int width = intersectionRightX - intersectionLeftX;   // Ширина пересечения
-    int height = intersectionBottomY - intersectionTopY;  // Высота пересечения
+    // Вычисляем ширину и высоту области пересечения (в 64 битах, разность тоже может переполнить int)
+    long long width = static_cast<long long>(intersectionRightX) - intersectionLeftX;   // Ширина пересечения
+    long long height = static_cast<long long>(intersectionBottomY) - intersectionTopY;  // Высота пересечения
     // Возвращаем площадь пересечения (ширина × высота)
-    return width * height;
+    return boxArea(width, height);
 }
 
 // Функция вычисления ограничивающего прямоугольника (bounding box)
@@ -86,8 +108,848 @@ Rectangle computeBoundingBox(const std::vector<Rectangle>& rectangles) {
     return Rectangle(minX, minY, maxX, maxY);
 }
 
+// Хранилище прямоугольников в формате "структура массивов" (SoA):
+// каждая координата лежит в своем непрерывном массиве, поэтому редукции
+// по одной координате читают память подряд и векторизуются
+class RectangleStore {
+private:
+    std::vector<int> m_x1, m_y1;  // Координаты верхних левых углов
+    std::vector<int> m_x2, m_y2;  // Координаты нижних правых углов
+
+public:
+    // Конструктор по умолчанию - пустое хранилище
+    RectangleStore() = default;
+
+    // Конструктор из массива структур (AoS)
+    explicit RectangleStore(const std::vector<Rectangle>& rectangles) {
+        reserve(rectangles.size());
+        for (const auto& rectangle : rectangles) push_back(rectangle);
+    }
+
+    // Резервирование памяти под count прямоугольников во всех четырех массивах
+    void reserve(std::size_t count) {
+        m_x1.reserve(count);
+        m_y1.reserve(count);
+        m_x2.reserve(count);
+        m_y2.reserve(count);
+    }
+
+    // Добавление прямоугольника в конец
+    void push_back(const Rectangle& rectangle) {
+        m_x1.push_back(rectangle.topLeftX);
+        m_y1.push_back(rectangle.topLeftY);
+        m_x2.push_back(rectangle.bottomRightX);
+        m_y2.push_back(rectangle.bottomRightY);
+    }
+
+    // Размер и проверка на пустоту
+    std::size_t size() const { return m_x1.size(); }
+    bool empty() const { return m_x1.empty(); }
+
+    // Сборка прямоугольника по индексу
+    Rectangle operator[](std::size_t index) const {
+        return Rectangle(m_x1[index], m_y1[index], m_x2[index], m_y2[index]);
+    }
+
+    // Доступ к массивам координат для вычислительных ядер
+    const int* x1() const { return m_x1.data(); }
+    const int* y1() const { return m_y1.data(); }
+    const int* x2() const { return m_x2.data(); }
+    const int* y2() const { return m_y2.data(); }
+};
+
+// SIMD-редукция минимума (Max = false) или максимума (Max = true) массива int
+// AVX-512: 16 чисел за инструкцию, AVX2: 8 чисел, хвост и сборка без SIMD - скалярно
+template <bool Max>
+int reduceMinMax(const int* data, std::size_t count) {
+    int result = Max ? std::numeric_limits<int>::min() : std::numeric_limits<int>::max();
+    std::size_t index = 0;
+#if defined(__AVX512F__)
+    // Два независимых аккумулятора, чтобы не ждать задержку предыдущей инструкции
+    __m512i first = _mm512_set1_epi32(result), second = first;
+    for (; index + 32 <= count; index += 32) {
+        __m512i a = _mm512_loadu_si512(data + index);
+        __m512i b = _mm512_loadu_si512(data + index + 16);
+        first = Max ? _mm512_max_epi32(first, a) : _mm512_min_epi32(first, a);
+        second = Max ? _mm512_max_epi32(second, b) : _mm512_min_epi32(second, b);
+    }
+    first = Max ? _mm512_max_epi32(first, second) : _mm512_min_epi32(first, second);
+    result = Max ? _mm512_reduce_max_epi32(first) : _mm512_reduce_min_epi32(first);
+#elif defined(__AVX2__)
+    __m256i first = _mm256_set1_epi32(result), second = first;
+    for (; index + 16 <= count; index += 16) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index + 8));
+        first = Max ? _mm256_max_epi32(first, a) : _mm256_min_epi32(first, a);
+        second = Max ? _mm256_max_epi32(second, b) : _mm256_min_epi32(second, b);
+    }
+    first = Max ? _mm256_max_epi32(first, second) : _mm256_min_epi32(first, second);
+    // Горизонтальная редукция 8 дорожек
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), first);
+    for (int lane : lanes) result = Max ? std::max(result, lane) : std::min(result, lane);
+#endif
+    // Скалярный хвост
+    for (; index < count; ++index) {
+        result = Max ? std::max(result, data[index]) : std::min(result, data[index]);
+    }
+    return result;
+}
+
+// Четыре редукции по координатам хранилища с многопоточностью:
+// массив делится на блоки, каждый поток считает свои четыре экстремума,
+// затем частичные результаты объединяются. Маленькие массивы считаются в одном потоке
+// MaxX1/MaxY1/MaxX2/MaxY2 - выбор максимума (true) или минимума (false) по каждой координате
+template <bool MaxX1, bool MaxY1, bool MaxX2, bool MaxY2>
+Rectangle reduceStore(const RectangleStore& store, unsigned threads) {
+    // Блок меньше 64K прямоугольников не окупает запуск потока
+    const std::size_t minimumChunk = 1 << 16;
+    std::size_t count = store.size();
+    threads = std::max(1u, std::min<unsigned>(threads, (count + minimumChunk - 1) / minimumChunk));
+    std::size_t chunk = (count + threads - 1) / threads;
+
+    // Редукция одного блока [begin, end)
+    auto reduceChunk = [&](std::size_t begin, std::size_t end) {
+        return Rectangle(reduceMinMax<MaxX1>(store.x1() + begin, end - begin),
+                         reduceMinMax<MaxY1>(store.y1() + begin, end - begin),
+                         reduceMinMax<MaxX2>(store.x2() + begin, end - begin),
+                         reduceMinMax<MaxY2>(store.y2() + begin, end - begin));
+    };
+    // Объединение двух частичных результатов
+    auto pick = [](bool max, int lhs, int rhs) { return max ? std::max(lhs, rhs) : std::min(lhs, rhs); };
+
+    std::vector<Rectangle> partial(threads, Rectangle(0, 0, 0, 0));
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::size_t begin = std::min(count, t * chunk);
+            partial[t] = reduceChunk(begin, std::min(count, begin + chunk));
+        });
+    }
+    // Первый блок считает текущий поток
+    partial[0] = reduceChunk(0, std::min(count, chunk));
+    for (auto& worker : workers) worker.join();
+
+    Rectangle result = partial[0];
+    for (unsigned t = 1; t < threads; ++t) {
+        result.topLeftX = pick(MaxX1, result.topLeftX, partial[t].topLeftX);
+        result.topLeftY = pick(MaxY1, result.topLeftY, partial[t].topLeftY);
+        result.bottomRightX = pick(MaxX2, result.bottomRightX, partial[t].bottomRightX);
+        result.bottomRightY = pick(MaxY2, result.bottomRightY, partial[t].bottomRightY);
+    }
+    return result;
+}
+
+// Площадь пересечения прямоугольников из SoA-хранилища (те же коды возврата: -1 - нет пересечения)
+// Пересечение - максимум левых/верхних и минимум правых/нижних границ
+long long calculateIntersectionArea(const RectangleStore& store,
+                                    unsigned threads = std::thread::hardware_concurrency()) {
+    if (store.empty()) return -1;
+    Rectangle intersection = reduceStore<true, true, false, false>(store, threads);
+    // Нет пересечения
+    if (intersection.topLeftX > intersection.bottomRightX || intersection.topLeftY > intersection.bottomRightY) {
+        return -1;
+    }
+    // Ширина и высота в 64 битах; ограничения на произведение - у boxArea
+    long long width = static_cast<long long>(intersection.bottomRightX) - intersection.topLeftX;
+    long long height = static_cast<long long>(intersection.bottomRightY) - intersection.topLeftY;
+    return boxArea(width, height);  // Для касания по границе одно из измерений равно 0
+}
+
+// Ограничивающий прямоугольник для SoA-хранилища
+// Минимум левых/верхних и максимум правых/нижних границ
+Rectangle computeBoundingBox(const RectangleStore& store,
+                             unsigned threads = std::thread::hardware_concurrency()) {
+    if (store.empty()) return Rectangle(0, 0, 0, 0);
+    return reduceStore<false, false, true, true>(store, threads);
+}
+
+// Бенчмарк: AoS-функции против SoA-хранилища в одном и во всех потоках
+void benchmark(std::size_t count) {
+    // Все прямоугольники содержат квадрат [1000, 2000] x [1000, 2000] - пересечение непустое
+    std::mt19937 random_generator(42);
+    std::uniform_int_distribution<int> low(0, 1000), high(2000, 3000);
+    std::vector<Rectangle> rectangles;
+    rectangles.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        rectangles.emplace_back(low(random_generator), low(random_generator),
+                                high(random_generator), high(random_generator));
+    }
+    RectangleStore store(rectangles);
+
+    // Измеряет время одного вызова в миллисекундах
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    long long areaAoS = 0, areaSoA = 0, areaParallel = 0;
+    Rectangle boxAoS(0, 0, 0, 0), boxSoA(0, 0, 0, 0), boxParallel(0, 0, 0, 0);
+    double timeAoS = measure([&] { areaAoS = calculateIntersectionArea(rectangles); boxAoS = computeBoundingBox(rectangles); });
+    double timeSoA = measure([&] { areaSoA = calculateIntersectionArea(store, 1); boxSoA = computeBoundingBox(store, 1); });
+    double timeParallel = measure([&] { areaParallel = calculateIntersectionArea(store); boxParallel = computeBoundingBox(store); });
+
+    // Результаты всех вариантов совпадают
+    assert(areaAoS == areaSoA && areaSoA == areaParallel);
+    assert(boxAoS.topLeftX == boxParallel.topLeftX && boxAoS.bottomRightY == boxParallel.bottomRightY);
+    assert(boxSoA.topLeftY == boxParallel.topLeftY && boxSoA.bottomRightX == boxParallel.bottomRightX);
+
+    std::cout << count << " rectangles (intersection + bounding box): AoS " << timeAoS
+              << " ms, SoA 1 thread " << timeSoA
+              << " ms, SoA all threads " << timeParallel << " ms" << std::endl;
+}
+
+// Проверка пересечения двух прямоугольников
+// Касание по границе тоже считается пересечением (как в calculateIntersectionArea, площадь 0)
+inline bool intersects(const Rectangle& first, const Rectangle& second) {
+    return first.topLeftX <= second.bottomRightX && second.topLeftX <= first.bottomRightX &&
+           first.topLeftY <= second.bottomRightY && second.topLeftY <= first.bottomRightY;
+}
+
+// Пары пересекающихся прямоугольников (i, j), i < j - результат соединения "все со всеми"
+using IntersectingPairs = std::vector<std::pair<std::size_t, std::size_t>>;
+
+// Запуск function(begin, end) над блоками [0, count) в нескольких потоках, по блоку на поток
+template <typename Function>
+void parallelFor(std::size_t count, unsigned threads, Function function) {
+    threads = std::max(1u, threads);
+    std::size_t chunk = (count + threads - 1) / threads;
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            std::size_t begin = std::min(count, t * chunk);
+            function(begin, std::min(count, begin + chunk));
+        });
+    }
+    for (auto& worker : workers) worker.join();
+}
+
+// Запуск function(begin, end, result) над блоками [0, count) в нескольких потоках:
+// у каждого блока свой вектор результатов, в конце они склеиваются по порядку блоков
+template <typename Result, typename Function>
+std::vector<Result> parallelCollect(std::size_t count, unsigned threads, Function function) {
+    threads = std::max(1u, threads);
+    std::size_t chunk = (count + threads - 1) / threads;
+    std::vector<std::vector<Result>> partial(threads);
+    // Блоки раздаются через parallelFor по номерам: потоку t достается блок t
+    parallelFor(threads, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t t = first; t < last; ++t) {
+            std::size_t begin = std::min(count, t * chunk);
+            function(begin, std::min(count, begin + chunk), partial[t]);
+        }
+    });
+
+    std::vector<Result> result;
+    for (auto& part : partial) result.insert(result.end(), part.begin(), part.end());
+    return result;
+}
+
+// Поиск перебором: индексы всех прямоугольников, пересекающих query, за O(N)
+std::vector<std::size_t> bruteForceQuery(const std::vector<Rectangle>& rectangles, const Rectangle& query) {
+    std::vector<std::size_t> result;
+    for (std::size_t i = 0; i < rectangles.size(); ++i) {
+        if (intersects(rectangles[i], query)) result.push_back(i);
+    }
+    return result;
+}
+
+// Соединение "все со всеми" перебором за O(N^2)
+IntersectingPairs bruteForcePairs(const std::vector<Rectangle>& rectangles) {
+    IntersectingPairs result;
+    for (std::size_t i = 0; i < rectangles.size(); ++i) {
+        for (std::size_t j = i + 1; j < rectangles.size(); ++j) {
+            if (intersects(rectangles[i], rectangles[j])) result.emplace_back(i, j);
+        }
+    }
+    return result;
+}
+
+// R-дерево с пакетной загрузкой методом STR (Sort-Tile-Recursive)
+// Все узлы одного уровня лежат в одном непрерывном массиве, дети узла - подряд
+// на уровне ниже, поэтому обход читает память последовательными блоками
+class RTree {
+public:
+    // Максимальное число детей у узла
+    static constexpr std::size_t nodeCapacity = 16;
+
+    // Построение дерева по массиву прямоугольников (индексы ответа - позиции в этом массиве)
+    explicit RTree(const std::vector<Rectangle>& rectangles) : m_rectangles(rectangles) {
+        // Нижний уровень - сами прямоугольники, first хранит их индекс
+        std::vector<Entry> level;
+        level.reserve(rectangles.size());
+        for (std::size_t i = 0; i < rectangles.size(); ++i) level.push_back({rectangles[i], i, 0});
+
+        // Упаковываем уровень за уровнем, пока не останется один корень
+        while (true) {
+            sortTileRecursive(level);
+            std::size_t size = level.size();
+            m_levels.push_back(std::move(level));
+            if (size <= 1) break;
+
+            // Узлы следующего уровня: каждый охватывает nodeCapacity соседних записей
+            const auto& children = m_levels.back();
+            std::vector<Entry> parents;
+            parents.reserve((size + nodeCapacity - 1) / nodeCapacity);
+            for (std::size_t first = 0; first < size; first += nodeCapacity) {
+                std::size_t count = std::min(nodeCapacity, size - first);
+                Rectangle box = children[first].box;
+                for (std::size_t i = first + 1; i < first + count; ++i) {
+                    box.topLeftX = std::min(box.topLeftX, children[i].box.topLeftX);
+                    box.topLeftY = std::min(box.topLeftY, children[i].box.topLeftY);
+                    box.bottomRightX = std::max(box.bottomRightX, children[i].box.bottomRightX);
+                    box.bottomRightY = std::max(box.bottomRightY, children[i].box.bottomRightY);
+                }
+                parents.push_back({box, first, count});
+            }
+            level = std::move(parents);
+        }
+    }
+
+    // Индексы прямоугольников, пересекающих query (добавляются в конец result)
+    void query(const Rectangle& query, std::vector<std::size_t>& result) const {
+        // Стек (уровень, позиция на уровне) вместо рекурсии
+        std::vector<std::pair<std::size_t, std::size_t>> stack;
+        std::size_t top = m_levels.size() - 1;
+        for (std::size_t i = 0; i < m_levels[top].size(); ++i) stack.emplace_back(top, i);
+
+        while (!stack.empty()) {
+            auto [level, index] = stack.back();
+            stack.pop_back();
+            const Entry& entry = m_levels[level][index];
+            // Поддерево не пересекает запрос - отбрасываем целиком
+            if (!intersects(entry.box, query)) continue;
+            if (level == 0) {
+                result.push_back(entry.first);
+            } else {
+                for (std::size_t child = entry.first; child < entry.first + entry.count; ++child) {
+                    stack.emplace_back(level - 1, child);
+                }
+            }
+        }
+    }
+
+    // Пакетный запрос: для каждого прямоугольника из queries - свой список ответов
+    // Запросы независимы и распределяются по потокам
+    std::vector<std::vector<std::size_t>> queryBatch(const std::vector<Rectangle>& queries,
+                                                     unsigned threads = std::thread::hardware_concurrency()) const {
+        std::vector<std::vector<std::size_t>> result(queries.size());
+        parallelFor(queries.size(), threads, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) query(queries[i], result[i]);
+        });
+        return result;
+    }
+
+    // Параллельное соединение "все со всеми": каждый прямоугольник - запрос к дереву,
+    // из ответа берем только j > i, чтобы каждая пара вошла один раз
+    IntersectingPairs allPairs(unsigned threads = std::thread::hardware_concurrency()) const {
+        return parallelCollect<std::pair<std::size_t, std::size_t>>(m_rectangles.size(), threads,
+            [&](std::size_t begin, std::size_t end, IntersectingPairs& pairs) {
+                std::vector<std::size_t> found;
+                for (std::size_t i = begin; i < end; ++i) {
+                    found.clear();
+                    query(m_rectangles[i], found);
+                    for (std::size_t j : found) {
+                        if (j > i) pairs.emplace_back(i, j);
+                    }
+                }
+            });
+    }
+
+private:
+    // Запись уровня: охватывающий прямоугольник и диапазон детей [first, first + count)
+    // на уровне ниже; на нижнем уровне first - индекс прямоугольника, count = 0
+    struct Entry {
+        Rectangle box;
+        std::size_t first;
+        std::size_t count;
+    };
+
+    // Упорядочивание STR: сортировка по центру X, нарезка на вертикальные полосы
+    // по S * nodeCapacity записей (S = sqrt(числа узлов)), внутри полосы - по центру Y
+    static void sortTileRecursive(std::vector<Entry>& entries) {
+        // Удвоенные координаты центра в 64 битах (без деления и переполнения)
+        auto centerX = [](const Entry& entry) { return static_cast<long long>(entry.box.topLeftX) + entry.box.bottomRightX; };
+        auto centerY = [](const Entry& entry) { return static_cast<long long>(entry.box.topLeftY) + entry.box.bottomRightY; };
+
+        std::size_t nodes = (entries.size() + nodeCapacity - 1) / nodeCapacity;
+        std::size_t slices = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(nodes))));
+        std::size_t sliceSize = std::max<std::size_t>(1, slices) * nodeCapacity;
+
+        std::sort(entries.begin(), entries.end(),
+                  [&](const Entry& lhs, const Entry& rhs) { return centerX(lhs) < centerX(rhs); });
+        for (std::size_t begin = 0; begin < entries.size(); begin += sliceSize) {
+            auto end = entries.begin() + std::min(entries.size(), begin + sliceSize);
+            std::sort(entries.begin() + begin, end,
+                      [&](const Entry& lhs, const Entry& rhs) { return centerY(lhs) < centerY(rhs); });
+        }
+    }
+
+    std::vector<Rectangle> m_rectangles;     // Исходные прямоугольники (для соединения)
+    std::vector<std::vector<Entry>> m_levels;  // Уровни дерева: [0] - листья, back() - корень
+};
+
+// Индекс на равномерной сетке: каждый прямоугольник записан во все ячейки, которые он задевает
+// Ячейки хранятся в формате CSR (смещения + один общий массив индексов), без вектора на ячейку.
+// Подходит для прямоугольников сравнимого размера; очень крупные попадают в множество ячеек
+class GridIndex {
+public:
+    // Построение сетки; cellsPerAxis = 0 - около sqrt(N) ячеек по каждой оси
+    explicit GridIndex(const std::vector<Rectangle>& rectangles, std::size_t cellsPerAxis = 0)
+        : m_rectangles(rectangles), m_bounds(computeBoundingBox(rectangles)) {
+        if (cellsPerAxis == 0) {
+            cellsPerAxis = static_cast<std::size_t>(std::sqrt(static_cast<double>(rectangles.size())));
+        }
+        m_cells = std::max<std::size_t>(1, cellsPerAxis);
+        // Размер ячейки с округлением вверх, чтобы последняя ячейка покрывала границу
+        long long width = static_cast<long long>(m_bounds.bottomRightX) - m_bounds.topLeftX + 1;
+        long long height = static_cast<long long>(m_bounds.bottomRightY) - m_bounds.topLeftY + 1;
+        m_cellWidth = std::max(1LL, (width + static_cast<long long>(m_cells) - 1) / static_cast<long long>(m_cells));
+        m_cellHeight = std::max(1LL, (height + static_cast<long long>(m_cells) - 1) / static_cast<long long>(m_cells));
+
+        // Проход 1: подсчет числа записей в каждой ячейке
+        m_cellStart.assign(m_cells * m_cells + 1, 0);
+        forEachCell(rectangles, [&](std::size_t cell, std::size_t) { ++m_cellStart[cell + 1]; });
+        // Префиксные суммы - начало каждой ячейки в общем массиве
+        for (std::size_t cell = 0; cell < m_cells * m_cells; ++cell) m_cellStart[cell + 1] += m_cellStart[cell];
+        // Проход 2: раскладка индексов по ячейкам
+        m_cellItems.resize(m_cellStart.back());
+        std::vector<std::size_t> fill(m_cellStart.begin(), m_cellStart.end() - 1);
+        forEachCell(rectangles, [&](std::size_t cell, std::size_t index) { m_cellItems[fill[cell]++] = index; });
+    }
+
+    // Индексы прямоугольников, пересекающих query (добавляются в конец result)
+    // Прямоугольник встречается в нескольких ячейках; чтобы выдать его один раз,
+    // засчитываем его только в ячейке, где лежит левый верхний угол пересечения
+    void query(const Rectangle& query, std::vector<std::size_t>& result) const {
+        if (m_rectangles.empty()) return;
+        for (std::size_t cy = cellY(query.topLeftY); cy <= cellY(query.bottomRightY); ++cy) {
+            for (std::size_t cx = cellX(query.topLeftX); cx <= cellX(query.bottomRightX); ++cx) {
+                std::size_t cell = cy * m_cells + cx;
+                for (std::size_t k = m_cellStart[cell]; k < m_cellStart[cell + 1]; ++k) {
+                    const Rectangle& candidate = m_rectangles[m_cellItems[k]];
+                    if (!intersects(candidate, query)) continue;
+                    // Проверка "своей" ячейки (reference point)
+                    if (cellX(std::max(candidate.topLeftX, query.topLeftX)) == cx &&
+                        cellY(std::max(candidate.topLeftY, query.topLeftY)) == cy) {
+                        result.push_back(m_cellItems[k]);
+                    }
+                }
+            }
+        }
+    }
+
+    // Пакетный запрос: для каждого прямоугольника из queries - свой список ответов
+    std::vector<std::vector<std::size_t>> queryBatch(const std::vector<Rectangle>& queries,
+                                                     unsigned threads = std::thread::hardware_concurrency()) const {
+        std::vector<std::vector<std::size_t>> result(queries.size());
+        parallelFor(queries.size(), threads, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) query(queries[i], result[i]);
+        });
+        return result;
+    }
+
+    // Параллельное соединение "все со всеми": потоки делят между собой ячейки,
+    // пары внутри ячейки проверяются попарно, пара засчитывается только в ячейке
+    // с левым верхним углом пересечения
+    IntersectingPairs allPairs(unsigned threads = std::thread::hardware_concurrency()) const {
+        return parallelCollect<std::pair<std::size_t, std::size_t>>(m_cells * m_cells, threads,
+            [&](std::size_t begin, std::size_t end, IntersectingPairs& pairs) {
+                for (std::size_t cell = begin; cell < end; ++cell) {
+                    std::size_t cx = cell % m_cells, cy = cell / m_cells;
+                    for (std::size_t a = m_cellStart[cell]; a < m_cellStart[cell + 1]; ++a) {
+                        const Rectangle& first = m_rectangles[m_cellItems[a]];
+                        for (std::size_t b = a + 1; b < m_cellStart[cell + 1]; ++b) {
+                            const Rectangle& second = m_rectangles[m_cellItems[b]];
+                            if (!intersects(first, second)) continue;
+                            if (cellX(std::max(first.topLeftX, second.topLeftX)) != cx ||
+                                cellY(std::max(first.topLeftY, second.topLeftY)) != cy) continue;
+                            pairs.emplace_back(std::min(m_cellItems[a], m_cellItems[b]),
+                                               std::max(m_cellItems[a], m_cellItems[b]));
+                        }
+                    }
+                }
+            });
+    }
+
+private:
+    // Номер столбца / строки сетки для координаты (координаты вне границ прижимаются к краю)
+    std::size_t cellX(int x) const {
+        long long cell = (static_cast<long long>(x) - m_bounds.topLeftX) / m_cellWidth;
+        return static_cast<std::size_t>(std::clamp(cell, 0LL, static_cast<long long>(m_cells) - 1));
+    }
+    std::size_t cellY(int y) const {
+        long long cell = (static_cast<long long>(y) - m_bounds.topLeftY) / m_cellHeight;
+        return static_cast<std::size_t>(std::clamp(cell, 0LL, static_cast<long long>(m_cells) - 1));
+    }
+
+    // Вызов function(ячейка, индекс прямоугольника) для всех ячеек, которые задевает каждый прямоугольник
+    template <typename Function>
+    void forEachCell(const std::vector<Rectangle>& rectangles, Function function) const {
+        for (std::size_t i = 0; i < rectangles.size(); ++i) {
+            for (std::size_t cy = cellY(rectangles[i].topLeftY); cy <= cellY(rectangles[i].bottomRightY); ++cy) {
+                for (std::size_t cx = cellX(rectangles[i].topLeftX); cx <= cellX(rectangles[i].bottomRightX); ++cx) {
+                    function(cy * m_cells + cx, i);
+                }
+            }
+        }
+    }
+
+    std::vector<Rectangle> m_rectangles;   // Исходные прямоугольники
+    Rectangle m_bounds;                    // Границы сетки (ограничивающий прямоугольник)
+    std::size_t m_cells = 1;               // Число ячеек по каждой оси
+    long long m_cellWidth = 1;             // Ширина ячейки
+    long long m_cellHeight = 1;            // Высота ячейки
+    std::vector<std::size_t> m_cellStart;  // Начало списка каждой ячейки (CSR-смещения)
+    std::vector<std::size_t> m_cellItems;  // Индексы прямоугольников, сгруппированные по ячейкам
+};
+
+// Случайные прямоугольники для тестов и бенчмарка: мир 1e8 x 1e8, размер стороны
+// до 2 * 1e8 / sqrt(N), так что в среднем каждый пересекается с несколькими соседями
+std::vector<Rectangle> randomRectangles(std::size_t count, std::mt19937& random_generator) {
+    const int world = 100'000'000;
+    int maxSide = std::max(1, static_cast<int>(2.0 * world / std::sqrt(static_cast<double>(std::max<std::size_t>(count, 1)))));
+    std::uniform_int_distribution<int> position(0, world), side(0, maxSide);
+    std::vector<Rectangle> rectangles;
+    rectangles.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        int x = position(random_generator), y = position(random_generator);
+        rectangles.emplace_back(x, y, x + side(random_generator), y + side(random_generator));
+    }
+    return rectangles;
+}
+
+// Бенчмарк пространственных индексов против перебора: построение, пакет запросов, соединение
+void benchmarkIndex(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::vector<Rectangle> rectangles = randomRectangles(count, random_generator);
+    std::vector<Rectangle> queries = randomRectangles(count, random_generator);
+    queries.resize(std::min<std::size_t>(queries.size(), 1000), Rectangle(0, 0, 0, 0));
+
+    // Измеряет время одного вызова в миллисекундах
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    std::size_t checksum = 0;
+    // Перебор: на больших N ограничиваем число запросов, иначе он идет минутами
+    std::size_t bruteQueries = std::max<std::size_t>(1, std::min(queries.size(), 100'000'000 / std::max<std::size_t>(count, 1)));
+    double bruteQuery = measure([&] {
+        for (std::size_t i = 0; i < bruteQueries; ++i) checksum += bruteForceQuery(rectangles, queries[i]).size();
+    }) / bruteQueries;
+
+    std::optional<RTree> tree;
+    std::optional<GridIndex> grid;
+    double treeBuild = measure([&] { tree.emplace(rectangles); });
+    double gridBuild = measure([&] { grid.emplace(rectangles); });
+    double treeQuery = measure([&] { for (const auto& found : tree->queryBatch(queries)) checksum += found.size(); }) / queries.size();
+    double gridQuery = measure([&] { for (const auto& found : grid->queryBatch(queries)) checksum += found.size(); }) / queries.size();
+    double treeJoin = measure([&] { checksum += tree->allPairs().size(); });
+    double gridJoin = measure([&] { checksum += grid->allPairs().size(); });
+
+    std::cout << count << " boxes: build R-tree " << treeBuild << " ms, grid " << gridBuild
+              << " ms; query (ms/query) brute " << bruteQuery << ", R-tree " << treeQuery << ", grid " << gridQuery
+              << "; all pairs R-tree " << treeJoin << " ms, grid " << gridJoin << " ms";
+    // Перебор всех пар O(N^2) запускаем только на небольших N
+    if (count <= 20'000) {
+        double bruteJoin = measure([&] { checksum += bruteForcePairs(rectangles).size(); });
+        std::cout << ", brute " << bruteJoin << " ms";
+    }
+    std::cout << " [checksum " << checksum << "]" << std::endl;
+}
+
+// Дерево отрезков над сжатыми Y-координатами для заметающей прямой
+// Для каждого узла хранит счетчик прямоугольников, накрывающих весь его отрезок,
+// и длины частей отрезка, накрытых не менее чем j раз (j = 1..k).
+// Память - 4 * ys.size() * (k + 1) чисел, поэтому k не должно превышать число прямоугольников
+class CoverageTree {
+public:
+    CoverageTree(const std::vector<int>& ys, int k)
+        : m_ys(ys), m_k(k), m_stride(static_cast<std::size_t>(k) + 1), m_nodes(4 * ys.size() * m_stride, 0) {}
+
+    // Добавление (delta = +1) или удаление (delta = -1) отрезка [ys[first], ys[last])
+    void update(std::size_t first, std::size_t last, int delta) {
+        if (first < last) update(1, 0, m_ys.size() - 1, first, last, delta);
+    }
+
+    // Длина по Y, накрытая не менее чем k отрезками
+    long long covered() const { return m_ys.size() < 2 ? 0 : length(1, 0, m_ys.size() - 1, m_k); }
+
+private:
+    // Длина отрезка узла, накрытая не менее чем j раз (j = 0 - длина всего отрезка)
+    long long length(std::size_t node, std::size_t left, std::size_t right, int j) const {
+        return j == 0 ? static_cast<long long>(m_ys[right]) - m_ys[left] : m_nodes[node * m_stride + j];
+    }
+
+    // Рекурсивное обновление на элементарных отрезках [left, right)
+    void update(std::size_t node, std::size_t left, std::size_t right,
+                std::size_t first, std::size_t last, int delta) {
+        if (last <= left || right <= first) return;
+        if (first <= left && right <= last) {
+            m_nodes[node * m_stride] += delta;
+        } else {
+            std::size_t middle = (left + right) / 2;
+            update(2 * node, left, middle, first, last, delta);
+            update(2 * node + 1, middle, right, first, last, delta);
+        }
+        pull(node, left, right);
+    }
+
+    // Пересчет длин узла: если сам узел накрыт c раз, то "не менее j раз" для j <= c -
+    // весь отрезок, а для j > c - сумма по детям "не менее (j - c) раз"
+    void pull(std::size_t node, std::size_t left, std::size_t right) {
+        std::size_t middle = (left + right) / 2;
+        long long cover = m_nodes[node * m_stride];
+        for (int j = 1; j <= m_k; ++j) {
+            long long& result = m_nodes[node * m_stride + j];
+            if (cover >= j) {
+                result = static_cast<long long>(m_ys[right]) - m_ys[left];
+            } else if (right - left == 1) {
+                result = 0;
+            } else {
+                int need = static_cast<int>(j - cover);
+                result = length(2 * node, left, middle, need) + length(2 * node + 1, middle, right, need);
+            }
+        }
+    }
+
+    const std::vector<int>& m_ys;    // Отсортированные уникальные Y-координаты
+    int m_k;                         // Требуемая кратность покрытия
+    std::size_t m_stride;            // Чисел на узел: k + 1 (в size_t - без переполнения int)
+    // Данные узлов подряд, по k + 1 чисел на узел: [0] - число прямоугольников,
+    // накрывающих весь отрезок узла, [j] - длина, накрытая не менее j раз.
+    // Счетчик и длины одного узла лежат в одной кэш-линии
+    std::vector<long long> m_nodes;
+};
+
+// Заметающая прямая по X в вертикальной полосе [slabLeft, slabRight):
+// прямоугольники обрезаются по полосе, события сортируются по X,
+// между соседними событиями площадь = накрытая длина по Y * шаг по X.
+// Прямоугольник, накрывающий полосу целиком, событий не порождает: такие прямоугольники
+// сводятся в базовое покрытие - кусочно-постоянную кратность по Y, ограниченную k,
+// которая добавляется в дерево один раз и действует на всей ширине полосы.
+// Площадь без знака: для полного диапазона int она достигает (2^32 - 1)^2 и не помещается в long long
+unsigned long long coveredAreaInSlab(const std::vector<Rectangle>& rectangles, int k, int slabLeft, int slabRight) {
+    // Кратность больше числа прямоугольников недостижима; дерево под такое k не строится
+    if (k < 1 || static_cast<std::size_t>(k) > rectangles.size()) return 0;
+    // Событие: вход (+1) или выход (-1) прямоугольника на координате x;
+    // y1, y2 после сжатия координат - номера в массиве ys
+    struct Event {
+        int x;
+        int delta;
+        int y1, y2;
+    };
+    std::vector<Event> events;
+    std::vector<int> ys;
+    std::vector<std::pair<int, int>> spanEnds;  // Концы Y-отрезков накрывающих полосу: (y, +1 / -1)
+    for (const auto& rectangle : rectangles) {
+        int x1 = std::max(rectangle.topLeftX, slabLeft), x2 = std::min(rectangle.bottomRightX, slabRight);
+        // Прямоугольники нулевой площади или вне полосы не влияют на ответ
+        if (x1 >= x2 || rectangle.topLeftY >= rectangle.bottomRightY) continue;
+        if (x1 == slabLeft && x2 == slabRight) {
+            spanEnds.emplace_back(rectangle.topLeftY, +1);
+            spanEnds.emplace_back(rectangle.bottomRightY, -1);
+            continue;
+        }
+        events.push_back({x1, +1, rectangle.topLeftY, rectangle.bottomRightY});
+        events.push_back({x2, -1, rectangle.topLeftY, rectangle.bottomRightY});
+        ys.push_back(rectangle.topLeftY);
+        ys.push_back(rectangle.bottomRightY);
+    }
+    if (events.empty() && spanEnds.empty()) return 0;
+
+    // Базовое покрытие: соседние куски с одинаковой кратностью min(c, k) сливаются,
+    // поэтому широкие прямоугольники, накрывающие друг друга, дают мало кусков
+    struct Piece {
+        int y1, y2;
+        int count;
+    };
+    std::vector<Piece> base;
+    std::sort(spanEnds.begin(), spanEnds.end());
+    int spanCount = 0;
+    for (std::size_t i = 0; i < spanEnds.size();) {
+        int y = spanEnds[i].first;
+        while (i < spanEnds.size() && spanEnds[i].first == y) spanCount += spanEnds[i++].second;
+        int capped = std::min(spanCount, k);
+        if (i == spanEnds.size() || capped == 0) continue;
+        int next = spanEnds[i].first;
+        if (!base.empty() && base.back().y2 == y && base.back().count == capped) {
+            base.back().y2 = next;
+        } else {
+            base.push_back({y, next, capped});
+        }
+    }
+    for (const auto& piece : base) {
+        ys.push_back(piece.y1);
+        ys.push_back(piece.y2);
+    }
+
+    // Сжатие координат Y
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+    for (auto& event : events) {
+        event.y1 = static_cast<int>(std::lower_bound(ys.begin(), ys.end(), event.y1) - ys.begin());
+        event.y2 = static_cast<int>(std::lower_bound(ys.begin(), ys.end(), event.y2) - ys.begin());
+    }
+
+    std::sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) { return lhs.x < rhs.x; });
+
+    CoverageTree tree(ys, k);
+    auto index = [&](int y) { return static_cast<std::size_t>(std::lower_bound(ys.begin(), ys.end(), y) - ys.begin()); };
+    for (const auto& piece : base) tree.update(index(piece.y1), index(piece.y2), piece.count);
+    // Заметание от левой до правой границы полосы: базовое покрытие действует и вне событий
+    unsigned long long area = 0;
+    int previousX = slabLeft;
+    for (const auto& event : events) {
+        // Площадь полосы между предыдущим и текущим событием (оба множителя меньше 2^32)
+        area += static_cast<unsigned long long>(tree.covered()) * static_cast<unsigned long long>(static_cast<long long>(event.x) - previousX);
+        previousX = event.x;
+        tree.update(event.y1, event.y2, event.delta);
+    }
+    area += static_cast<unsigned long long>(tree.covered()) * static_cast<unsigned long long>(static_cast<long long>(slabRight) - previousX);
+    return area;
+}
+
+// Площадь, накрытая не менее чем k прямоугольниками (k = 1 - площадь объединения), за O(N log N * k)
+// Плоскость делится на вертикальные полосы (границы - квантили левых сторон), и полосы считаются
+// независимо в нескольких потоках. Прямоугольник обрезается по каждой задетой полосе, а в полосах,
+// которые накрывает целиком, входит в базовое покрытие без событий (см. coveredAreaInSlab).
+// Разбиение выбирается по числу копий прямоугольников в полосах:
+// - полосы примерно по 32K прямоугольников, пока копий не больше 2N: дерево отрезков полосы
+//   помещается в кэш, и даже один поток работает вдвое быстрее, чем при одном общем заметании;
+// - иначе (много широких прямоугольников) копии сделали бы работу O(N * полос),
+//   поэтому полос столько же, сколько потоков, а в одном потоке - одно общее заметание.
+// Площади - точные целые, поэтому результат не зависит от разбиения и числа потоков
+unsigned long long coveredArea(const std::vector<Rectangle>& rectangles, int k = 1,
+                               unsigned threads = std::thread::hardware_concurrency()) {
+    if (k < 1 || static_cast<std::size_t>(k) > rectangles.size()) return 0;  // В том числе пустой массив
+    threads = std::max(1u, threads);
+    const std::size_t slabSize = 1 << 15;
+    if (rectangles.size() < slabSize && threads == 1) {
+        return coveredAreaInSlab(rectangles, k, std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    }
+
+    std::vector<int> lefts;
+    lefts.reserve(rectangles.size());
+    for (const auto& rectangle : rectangles) lefts.push_back(rectangle.topLeftX);
+    std::sort(lefts.begin(), lefts.end());
+    // Границы полос - квантили левых границ прямоугольников
+    auto makeBounds = [&](std::size_t slabs) {
+        std::vector<int> bounds = { std::numeric_limits<int>::min() };
+        for (std::size_t slab = 1; slab < slabs; ++slab) bounds.push_back(lefts[slab * lefts.size() / slabs]);
+        bounds.push_back(std::numeric_limits<int>::max());
+        return bounds;
+    };
+    // Полосы [first, last], которые задевает прямоугольник
+    auto slabRange = [](const std::vector<int>& bounds, const Rectangle& rectangle) {
+        std::size_t first = std::upper_bound(bounds.begin(), bounds.end(), rectangle.topLeftX) - bounds.begin() - 1;
+        std::size_t last = std::lower_bound(bounds.begin(), bounds.end(), rectangle.bottomRightX) - bounds.begin() - 1;
+        return std::pair{first, std::max(first, last)};
+    };
+
+    std::size_t slabs = std::max<std::size_t>(threads, (rectangles.size() + slabSize - 1) / slabSize);
+    std::vector<int> bounds = makeBounds(slabs);
+    std::size_t copies = 0;
+    for (const auto& rectangle : rectangles) {
+        auto [first, last] = slabRange(bounds, rectangle);
+        copies += last - first + 1;
+    }
+    if (copies > 2 * rectangles.size()) { // Много широких прямоугольников
+        if (threads == 1) {
+            return coveredAreaInSlab(rectangles, k, std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+        }
+        slabs = threads;
+        bounds = makeBounds(slabs);
+    }
+
+    // Раскладка прямоугольников по полосам, которые они задевают
+    std::vector<std::vector<Rectangle>> buckets(slabs);
+    for (const auto& rectangle : rectangles) {
+        if (rectangle.topLeftX >= rectangle.bottomRightX || rectangle.topLeftY >= rectangle.bottomRightY) continue;
+        auto [first, last] = slabRange(bounds, rectangle);
+        for (std::size_t slab = first; slab <= last; ++slab) buckets[slab].push_back(rectangle);
+    }
+
+    // Потоки делят полосы на непрерывные группы
+    std::vector<unsigned long long> partial(slabs, 0);
+    parallelFor(slabs, threads, [&](std::size_t first, std::size_t last) {
+        for (std::size_t slab = first; slab < last; ++slab) {
+            partial[slab] = coveredAreaInSlab(buckets[slab], k, bounds[slab], bounds[slab + 1]);
+        }
+    });
+
+    // Сумма не переполняется: вся площадь не больше площади ограничивающего прямоугольника
+    unsigned long long area = 0;
+    for (unsigned long long value : partial) area += value;
+    return area;
+}
+
+// Площадь объединения прямоугольников
+unsigned long long unionArea(const std::vector<Rectangle>& rectangles,
+                             unsigned threads = std::thread::hardware_concurrency()) {
+    return coveredArea(rectangles, 1, threads);
+}
+
+// Эталон для тестов: площадь, накрытая не менее k раз, перебором по сжатой сетке за O(N^3)
+unsigned long long bruteForceCoveredArea(const std::vector<Rectangle>& rectangles, int k) {
+    std::vector<int> xs, ys;
+    for (const auto& rectangle : rectangles) {
+        xs.push_back(rectangle.topLeftX);
+        xs.push_back(rectangle.bottomRightX);
+        ys.push_back(rectangle.topLeftY);
+        ys.push_back(rectangle.bottomRightY);
+    }
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+    unsigned long long area = 0;
+    for (std::size_t i = 0; i + 1 < xs.size(); ++i) {
+        for (std::size_t j = 0; j + 1 < ys.size(); ++j) {
+            int count = 0;
+            for (const auto& rectangle : rectangles) {
+                count += rectangle.topLeftX <= xs[i] && xs[i + 1] <= rectangle.bottomRightX &&
+                         rectangle.topLeftY <= ys[j] && ys[j + 1] <= rectangle.bottomRightY;
+            }
+            if (count >= k) {
+                area += static_cast<unsigned long long>(static_cast<long long>(xs[i + 1]) - xs[i]) *
+                        static_cast<unsigned long long>(static_cast<long long>(ys[j + 1]) - ys[j]);
+            }
+        }
+    }
+    return area;
+}
+
+// Бенчмарк заметающей прямой: площадь объединения и покрытия не менее 2 раз
+void benchmarkCoverage(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::vector<Rectangle> rectangles = randomRectangles(count, random_generator);
+
+    // Измеряет время одного вызова в миллисекундах
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    unsigned long long sequential = 0, parallel = 0, twice = 0;
+    double sequentialTime = measure([&] { sequential = unionArea(rectangles, 1); });
+    double parallelTime = measure([&] { parallel = unionArea(rectangles); });
+    double twiceTime = measure([&] { twice = coveredArea(rectangles, 2); });
+    assert(sequential == parallel);
+
+    std::cout << count << " boxes: union area " << parallel << " (1 thread " << sequentialTime
+              << " ms, all threads " << parallelTime << " ms), covered twice " << twice
+              << " (" << twiceTime << " ms)" << std::endl;
+}
+
 // Главная функция программы
-int main() {
+int main(int argc, char** argv) {
     // Тест 1: Пересекающиеся прямоугольники
     std::vector<Rectangle> testCase1 = {
         Rectangle(0, 0, 10, 10),   // Первый прямоугольник
@@ -118,8 +980,131 @@ int main() {
     assert(boundingRect.topLeftX == 0 && boundingRect.topLeftY == 0);
     assert(boundingRect.bottomRightX == 15 && boundingRect.bottomRightY == 15);
     
+    // Тест 5: Площадь больше INT_MAX считается без переполнения
+    std::vector<Rectangle> testCase5 = {
+        Rectangle(0, 0, 100000, 100000),
+        Rectangle(-5, -5, 200000, 200000)
+    };
+    assert(calculateIntersectionArea(testCase5) == 10'000'000'000LL);
+    // Наибольшие допустимые координаты boxArea: площадь 2^62
+    std::vector<Rectangle> widest = { Rectangle(-(1 << 30), -(1 << 30), 1 << 30, 1 << 30) };
+    assert(calculateIntersectionArea(widest) == 1LL << 62);
+    assert(calculateIntersectionArea(RectangleStore(widest)) == 1LL << 62);
+
+    // Тест 6: SoA-хранилище дает те же ответы, что и функции над std::vector<Rectangle>
+    for (const auto& testCase : { testCase1, testCase2, testCase3, testCase5 }) {
+        RectangleStore store(testCase);
+        assert(calculateIntersectionArea(store) == calculateIntersectionArea(testCase));
+        Rectangle box = computeBoundingBox(store);
+        Rectangle expected = computeBoundingBox(testCase);
+        assert(box.topLeftX == expected.topLeftX && box.topLeftY == expected.topLeftY);
+        assert(box.bottomRightX == expected.bottomRightX && box.bottomRightY == expected.bottomRightY);
+    }
+    assert(calculateIntersectionArea(RectangleStore()) == -1);
+
+    // Тест 7: Многопоточная редукция на большом массиве (несколько блоков и SIMD-хвост)
+    std::vector<Rectangle> many;
+    for (int i = 0; i < 300'001; ++i) {
+        many.emplace_back(i % 1000, (i * 7) % 1000, 5000 + i % 777, 5000 + (i * 3) % 999);
+    }
+    RectangleStore manyStore(many);
+    assert(calculateIntersectionArea(manyStore, 4) == calculateIntersectionArea(many));
+    Rectangle manyBox = computeBoundingBox(manyStore, 4);
+    Rectangle manyExpected = computeBoundingBox(many);
+    assert(manyBox.bottomRightX == manyExpected.bottomRightX && manyBox.bottomRightY == manyExpected.bottomRightY);
+    assert(manyBox.topLeftX == manyExpected.topLeftX && manyBox.topLeftY == manyExpected.topLeftY);
+
+    // Тест 8: R-дерево и сетка дают те же ответы, что и перебор
+    std::mt19937 random_generator(7);
+    std::vector<Rectangle> boxes = randomRectangles(3000, random_generator);
+    std::vector<Rectangle> queries = randomRectangles(200, random_generator);
+    queries.emplace_back(-10, -10, -5, -5);                        // Запрос вне всех прямоугольников
+    queries.emplace_back(0, 0, 100'000'000, 100'000'000);          // Запрос, накрывающий все
+    queries.push_back(boxes[0]);                                   // Запрос, совпадающий с прямоугольником
+    RTree tree(boxes);
+    GridIndex grid(boxes);
+    auto treeAnswers = tree.queryBatch(queries, 4);
+    auto gridAnswers = grid.queryBatch(queries, 4);
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        auto expected = bruteForceQuery(boxes, queries[i]);
+        std::sort(treeAnswers[i].begin(), treeAnswers[i].end());
+        std::sort(gridAnswers[i].begin(), gridAnswers[i].end());
+        assert(treeAnswers[i] == expected);
+        assert(gridAnswers[i] == expected);
+    }
+    auto expectedPairs = bruteForcePairs(boxes);
+    auto treePairs = tree.allPairs(4);
+    auto gridPairs = grid.allPairs(4);
+    std::sort(treePairs.begin(), treePairs.end());
+    std::sort(gridPairs.begin(), gridPairs.end());
+    assert(!expectedPairs.empty());
+    assert(treePairs == expectedPairs);
+    assert(gridPairs == expectedPairs);
+
+    // Тест 9: Касание по границе - тоже пересечение; пустой индекс ничего не находит
+    RTree touching(testCase3);
+    assert(touching.allPairs(2) == IntersectingPairs({{0, 1}}));
+    assert(GridIndex(testCase3, 4).allPairs(2) == IntersectingPairs({{0, 1}}));
+    std::vector<std::size_t> none;
+    RTree({}).query(Rectangle(0, 0, 1, 1), none);
+    GridIndex({}).query(Rectangle(0, 0, 1, 1), none);
+    assert(none.empty());
+
+    // Тест 10: Площадь объединения и покрытия не менее k раз
+    assert(unionArea(testCase1) == 100 + 100 - 25);
+    assert(coveredArea(testCase1, 2) == 25);
+    assert(coveredArea(testCase1, 3) == 0);
+    // k больше числа прямоугольников: ответ 0 без построения дерева на k + 1 чисел в узле
+    assert(coveredArea(testCase1, 1'000'000) == 0);
+    assert(coveredArea(testCase1, std::numeric_limits<int>::max()) == 0);
+    assert(coveredAreaInSlab(testCase1, std::numeric_limits<int>::max(), 0, 100) == 0);
+    assert(unionArea(testCase3) == 100 + 40 * 45);     // Касание по границе не дает общей площади
+    assert(unionArea(testCase5) == 200'005LL * 200'005);  // Второй содержит первый; площадь больше INT_MAX
+    assert(unionArea({}) == 0);
+    // Полный диапазон int: площадь (2^32 - 1)^2 больше LLONG_MAX
+    const int minInt = std::numeric_limits<int>::min(), maxInt = std::numeric_limits<int>::max();
+    std::vector<Rectangle> fullRange = { Rectangle(minInt, minInt, maxInt, maxInt), Rectangle(0, 0, maxInt, maxInt) };
+    const unsigned long long fullArea = 0xFFFFFFFFull * 0xFFFFFFFFull;
+    assert(unionArea(fullRange, 1) == fullArea && unionArea(fullRange, 4) == fullArea);
+    assert(coveredArea(fullRange, 2) == 0x7FFFFFFFull * 0x7FFFFFFFull);
+    assert(bruteForceCoveredArea(fullRange, 1) == fullArea);
+    std::vector<Rectangle> small = randomRectangles(60, random_generator);
+    small.emplace_back(5, 5, 5, 10);  // Вырожденный прямоугольник нулевой площади
+    for (int k = 1; k <= 3; ++k) {
+        unsigned long long expected = bruteForceCoveredArea(small, k);
+        assert(coveredArea(small, k, 1) == expected);
+        assert(coveredAreaInSlab(small, k, 0, 50'000'000) + coveredAreaInSlab(small, k, 50'000'000, 200'000'000) == expected);
+    }
+    // Многопоточный вариант (несколько полос) совпадает с однопоточным
+    std::vector<Rectangle> large = randomRectangles(200'000, random_generator);
+    assert(coveredArea(large, 1, 4) == coveredArea(large, 1, 1));
+    assert(coveredArea(large, 2, 3) == coveredArea(large, 2, 1));
+    // Широкие прямоугольники через все полосы входят в базовое покрытие полос
+    for (std::size_t i = 0; i < large.size(); i += 2) {
+        large[i].topLeftX = i % 4 == 0 ? minInt : -5;
+        large[i].bottomRightX = i % 8 == 0 ? maxInt : 150'000'000;
+    }
+    for (int k = 1; k <= 3; ++k) assert(coveredArea(large, k, 4) == coveredArea(large, k, 1));
+    std::vector<Rectangle> stripes = { Rectangle(minInt, 0, maxInt, 10), Rectangle(minInt, 5, maxInt, 20) };
+    for (int i = 0; i < 40'000; ++i) stripes.emplace_back(i * 1000, 0, i * 1000 + 500, 30);
+    assert(coveredArea(stripes, 2, 4) == bruteForceCoveredArea({ stripes[0], stripes[1] }, 2) + 40'000ull * 500 * 15);
+
     // Если все тесты прошли, выводим сообщение об успехе
     std::cout << "All tests passed" << std::endl;
+
+    // Бенчмарк: число прямоугольников задается аргументом (по умолчанию 1e7)
+    std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    benchmark(count);
+
+    // Бенчмарк индексов: от 1e4 до максимального числа прямоугольников (по умолчанию 1e6, до 1e7 через аргумент)
+    std::size_t maxIndexCount = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1'000'000;
+    for (std::size_t indexCount = 10'000; indexCount <= maxIndexCount; indexCount *= 10) {
+        benchmarkIndex(indexCount);
+    }
+
+    // Бенчмарк площади объединения (по умолчанию 1e6 прямоугольников)
+    std::size_t coverageCount = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1'000'000;
+    benchmarkCoverage(coverageCount);
     
     // Возвращаем 0 - признак успешного завершения программы
     return 0;
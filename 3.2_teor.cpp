@@ -3,6 +3,14 @@
 #include <numbers>      // Для математических констант (std::numbers::pi)
 #include <cmath>        // Для математических функций (std::sqrt, std::abs)
 #include <cassert>      // Для макроса assert (проверка условий)
+#include <algorithm>    // Для std::shuffle (перемешивание коллекции в бенчмарке)
+#include <chrono>       // Для измерения времени в бенчмарке
+#include <cstddef>      // Для std::size_t
+#include <cstdlib>      // Для std::strtoull (разбор аргументов командной строки)
+#include <memory>       // Для std::unique_ptr (владение объектами с виртуальной диспетчеризацией)
+#include <random>       // Для генерации случайных фигур
+#include <variant>      // Для std::variant и std::visit
+#include <vector>       // Для контейнера std::vector
 
 // Класс для представления треугольника
 class Triangle {
@@ -79,8 +87,160 @@ public:
     }
 };
 
+// Три способа диспетчеризации поверх одних и тех же невиртуальных классов.
+// У всех один и тот же интерфейс: area() и perimeter()
+
+// 1. Виртуальная диспетчеризация: абстрактный базовый класс Shape (как в 3.6_tepr.cpp)
+// и адаптер, который оборачивает невиртуальный класс
+class Shape {
+public:
+    virtual ~Shape() = default;
+    virtual double perimeter() const = 0;
+    virtual double area() const = 0;
+};
+
+template <typename T>
+class VirtualShape final : public Shape {
+private:
+    T m_shape;  // Обернутая фигура
+
+public:
+    VirtualShape(T shape) : m_shape(shape) {}
+    double area() const override { return m_shape.area(); }
+    double perimeter() const override { return m_shape.perimeter(); }
+};
+
+// 2. std::variant: фигура хранится по значению, тип выбирается через std::visit
+// (таблица переходов по индексу типа, без кучи и без указателей)
+class VariantShape {
+private:
+    std::variant<Triangle, Square, Circle> m_shape;
+
+public:
+    template <typename T>
+    VariantShape(T shape) : m_shape(shape) {}
+    double area() const {
+        return std::visit([](const auto& shape) { return shape.area(); }, m_shape);
+    }
+    double perimeter() const {
+        return std::visit([](const auto& shape) { return shape.perimeter(); }, m_shape);
+    }
+};
+
+// 3. CRTP (статический полиморфизм): тип фигуры известен на этапе компиляции,
+// вызовы разрешаются статически и встраиваются. Производный класс обязан
+// определить area() и perimeter() - методы базового класса перенаправляют к ним
+template <typename Derived>
+class StaticShape {
+public:
+    double area() const { return static_cast<const Derived&>(*this).area(); }
+    double perimeter() const { return static_cast<const Derived&>(*this).perimeter(); }
+};
+
+template <typename T>
+class CRTPShape final : public StaticShape<CRTPShape<T>> {
+private:
+    T m_shape;  // Обернутая фигура
+
+public:
+    CRTPShape(T shape) : m_shape(shape) {}
+    double area() const { return m_shape.area(); }
+    double perimeter() const { return m_shape.perimeter(); }
+};
+
+// Обобщенный алгоритм над статическим интерфейсом: работает с любой CRTP-фигурой
+template <typename Derived>
+double areaPlusPerimeter(const StaticShape<Derived>& shape) {
+    return shape.area() + shape.perimeter();
+}
+
+// Бенчмарк диспетчеризации: время на один вызов area() + perimeter() для коллекций
+// одного типа (homogeneous) и перемешанных трех типов (shuffled).
+// CRTP требует типа, известного при компиляции, поэтому меряется только на однородных коллекциях
+void benchmark(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::uniform_real_distribution<double> length(1.0, 10.0);
+
+    // Измеряет время прохода в наносекундах на фигуру; sum не дает выбросить вычисления
+    double sum = 0.0;
+    auto measure = [&](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        sum += function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::nano>(end - begin).count() / count;
+    };
+    // Сумма по коллекции указателей и по коллекции значений
+    auto sumPointers = [](const auto& list) {
+        double total = 0.0;
+        for (const auto& shape : list) total += shape->area() + shape->perimeter();
+        return total;
+    };
+    auto sumValues = [](const auto& list) {
+        double total = 0.0;
+        for (const auto& shape : list) total += shape.area() + shape.perimeter();
+        return total;
+    };
+
+    // Однородная коллекция окружностей во всех трех представлениях
+    std::vector<std::unique_ptr<Shape>> virtualCircles;
+    std::vector<VariantShape> variantCircles;
+    std::vector<CRTPShape<Circle>> crtpCircles;
+    for (std::size_t i = 0; i < count; ++i) {
+        Circle circle(length(random_generator));
+        virtualCircles.push_back(std::make_unique<VirtualShape<Circle>>(circle));
+        variantCircles.emplace_back(circle);
+        crtpCircles.emplace_back(circle);
+    }
+    double virtualHomogeneous = measure([&] { return sumPointers(virtualCircles); });
+    double variantHomogeneous = measure([&] { return sumValues(variantCircles); });
+    double crtpHomogeneous = measure([&] {
+        double total = 0.0;
+        for (const auto& shape : crtpCircles) total += areaPlusPerimeter(shape);
+        return total;
+    });
+
+    // Перемешанная коллекция трех типов
+    std::vector<std::unique_ptr<Shape>> virtualMixed;
+    std::vector<VariantShape> variantMixed;
+    for (std::size_t i = 0; i < count; ++i) {
+        double a = length(random_generator);
+        switch (i % 3) {
+        case 0:
+            virtualMixed.push_back(std::make_unique<VirtualShape<Triangle>>(Triangle(a, a, a)));
+            variantMixed.emplace_back(Triangle(a, a, a));
+            break;
+        case 1:
+            virtualMixed.push_back(std::make_unique<VirtualShape<Square>>(Square(a)));
+            variantMixed.emplace_back(Square(a));
+            break;
+        default:
+            virtualMixed.push_back(std::make_unique<VirtualShape<Circle>>(Circle(a)));
+            variantMixed.emplace_back(Circle(a));
+            break;
+        }
+    }
+    // Одинаковая перестановка для обеих коллекций
+    std::vector<std::size_t> order(count);
+    for (std::size_t i = 0; i < count; ++i) order[i] = i;
+    std::shuffle(order.begin(), order.end(), random_generator);
+    std::vector<std::unique_ptr<Shape>> virtualShuffled(count);
+    std::vector<VariantShape> variantShuffled;
+    variantShuffled.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        virtualShuffled[i] = std::move(virtualMixed[order[i]]);
+        variantShuffled.push_back(variantMixed[order[i]]);
+    }
+    double virtualShuffledTime = measure([&] { return sumPointers(virtualShuffled); });
+    double variantShuffledTime = measure([&] { return sumValues(variantShuffled); });
+
+    std::cout << count << " shapes (ns per area + perimeter): homogeneous virtual " << virtualHomogeneous
+              << ", variant " << variantHomogeneous << ", CRTP " << crtpHomogeneous
+              << "; shuffled virtual " << virtualShuffledTime << ", variant " << variantShuffledTime
+              << " [checksum " << sum << "]" << std::endl;
+}
+
 // Главная функция программы
-int main() {
+int main(int argc, char** argv) {
     // Тестирование класса Triangle
     // Создаем треугольник со сторонами 3, 4, 5 (египетский треугольник)
     Triangle triangle(3.0, 4.0, 5.0);
@@ -113,6 +273,25 @@ int main() {
     // Выводим сообщение об успешном тесте
     std::cout << "Circle test is passed" << std::endl;
 
+    // Тестирование трех способов диспетчеризации: одинаковый API и одинаковые результаты
+    std::vector<std::unique_ptr<Shape>> virtualShapes;
+    virtualShapes.push_back(std::make_unique<VirtualShape<Triangle>>(triangle));
+    virtualShapes.push_back(std::make_unique<VirtualShape<Square>>(square));
+    virtualShapes.push_back(std::make_unique<VirtualShape<Circle>>(circle));
+    std::vector<VariantShape> variantShapes = { triangle, square, circle };
+    CRTPShape<Triangle> crtpTriangle(triangle);
+    CRTPShape<Square> crtpSquare(square);
+    CRTPShape<Circle> crtpCircle(circle);
+    assert(virtualShapes[0]->area() == 6.0 && variantShapes[0].area() == 6.0 && crtpTriangle.area() == 6.0);
+    assert(virtualShapes[1]->perimeter() == 20.0 && variantShapes[1].perimeter() == 20.0 && crtpSquare.perimeter() == 20.0);
+    assert(virtualShapes[2]->area() == circle.area() && variantShapes[2].area() == circle.area());
+    assert(areaPlusPerimeter(crtpCircle) == circle.area() + circle.perimeter());
+    std::cout << "Dispatch test is passed" << std::endl;
+
+    // Бенчмарк: число фигур задается аргументом командной строки (по умолчанию 1e6)
+    std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    benchmark(count);
+
     // Возвращаем 0 - признак успешного завершения программы
     return 0;
 }
\ No newline at end of file
@@ -1,31 +1,236 @@
 // Подключение необходимых библиотек
 #include <iostream>  // Для ввода-вывода (std::cout, std::endl)
 #include <cassert>   // Для макроса assert (проверка условий)
+#include <algorithm> // Для std::sort, std::binary_search (хеш-указатели, перцентили)
+#include <atomic>    // Для std::atomic (конкурентные очереди)
+#include <chrono>    // Для измерения времени в бенчмарке
+#include <cstddef>   // Для std::size_t
+#include <cstdint>   // Для std::uint64_t (номера ячеек кольцевого буфера)
+#include <cstdlib>   // Для std::strtoull (размер из аргументов)
+#include <deque>     // Для std::deque (эталон в тестах)
+#include <memory>    // Для std::unique_ptr (пачки пула узлов)
+#include <mutex>     // Для std::mutex (список освобождений завершившихся потоков)
+#include <new>       // Для размещающего new
+#include <iterator>  // Для std::bidirectional_iterator_tag (итератор списка)
+#include <optional>  // Для std::optional (результат pop_front конкурентных очередей)
+#include <ranges>    // Для std::ranges::input_range (append_range)
+#include <random>    // Для генерации случайных операций в тестах
+#include <stdexcept> // Для std::runtime_error (исчерпание записей хеш-указателей)
+#include <thread>    // Для std::thread (производители и потребители)
+#include <type_traits> // Для std::is_empty_v (перенос части списка)
+#include <utility>   // Для std::forward, std::exchange
+#include <vector>    // Для std::vector (пачки пула, сравнение в бенчмарке)
 
-// Класс односвязного списка
-class List {
+// Стратегия выделения узлов: каждый узел отдельно через new/delete
+template <typename T>
+class HeapAllocator {
+public:
+    template <typename... Args>
+    T* create(Args&&... args) { return new T(std::forward<Args>(args)...); }
+    void destroy(T* object) { delete object; }
+    // Каждый узел удаляется отдельно, поэтому заранее выделить их одним блоком нельзя
+    void reserve(std::size_t) {}
+    // Узлы из кучи не принадлежат распределителю - передавать нечего
+    void adopt(HeapAllocator&) {}
+};
+
+// Стратегия выделения узлов: пачки (slab) по ~64 КБ со списком свободных слотов
+// Новые узлы берутся подряд из последней пачки, поэтому соседние узлы лежат рядом в памяти;
+// освобожденные слоты переиспользуются в первую очередь. Память возвращается при уничтожении пула
+// adopt забирает пачки другого пула, чтобы его узлы можно было перенести в список этого пула
+template <typename T>
+class SlabAllocator {
+private:
+    // Слот хранит либо узел, либо указатель на следующий свободный слот
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    static constexpr std::size_t slabBytes = 1 << 16;  // Размер пачки
+    static constexpr std::size_t slabSlots = slabBytes / sizeof(Slot) > 0 ? slabBytes / sizeof(Slot) : 1;
+
+    std::vector<std::unique_ptr<Slot[]>> slabs;  // Выделенные пачки
+    Slot* freeList = nullptr;                    // Список освобожденных слотов
+    Slot* freeTail = nullptr;                    // Последний слот списка свободных (для adopt за O(1))
+    Slot* cursor = nullptr;                      // Следующий нетронутый слот последней пачки
+    Slot* slabEnd = nullptr;                     // Конец последней пачки
+    std::size_t reserved = 0;                    // Сколько слотов еще выдать подряд из cursor
+
+public:
+    SlabAllocator() = default;
+    SlabAllocator(const SlabAllocator&) = delete;
+    SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+    // Перемещение: пачки переходят вместе с узлами, исходный пул становится пустым
+    SlabAllocator(SlabAllocator&& other) noexcept
+        : slabs(std::move(other.slabs)), freeList(std::exchange(other.freeList, nullptr)),
+          freeTail(std::exchange(other.freeTail, nullptr)), cursor(std::exchange(other.cursor, nullptr)),
+          slabEnd(std::exchange(other.slabEnd, nullptr)), reserved(std::exchange(other.reserved, 0)) {
+        other.slabs.clear();
+    }
+    SlabAllocator& operator=(SlabAllocator&& other) noexcept {
+        if (this != &other) {
+            slabs = std::move(other.slabs);
+            other.slabs.clear();
+            freeList = std::exchange(other.freeList, nullptr);
+            freeTail = std::exchange(other.freeTail, nullptr);
+            cursor = std::exchange(other.cursor, nullptr);
+            slabEnd = std::exchange(other.slabEnd, nullptr);
+            reserved = std::exchange(other.reserved, 0);
+        }
+        return *this;
+    }
+
+    // Гарантия, что следующие count созданий возьмут слоты подряд из одной пачки
+    // (при нехватке выделяется одна пачка на все count слотов)
+    void reserve(std::size_t count) {
+        if (static_cast<std::size_t>(slabEnd - cursor) >= count) return;
+        std::size_t size = std::max(count, slabSlots);
+        slabs.emplace_back(new Slot[size]);
+        cursor = slabs.back().get();
+        slabEnd = cursor + size;
+        reserved = count;
+    }
+
+    // Присоединение пачек другого пула: его узлы становятся узлами этого пула
+    // Стоимость - O(число пачек other); нетронутый остаток меньшей из последних пачек не используется
+    void adopt(SlabAllocator& other) {
+        if (this == &other) return;
+        for (auto& slab : other.slabs) slabs.push_back(std::move(slab));
+        other.slabs.clear();
+        if (other.freeList != nullptr) { // Список свободных other дописывается в начало нашего
+            other.freeTail->next = freeList;
+            if (freeList == nullptr) freeTail = other.freeTail;
+            freeList = other.freeList;
+        }
+        if (other.slabEnd - other.cursor > slabEnd - cursor) {
+            cursor = other.cursor;
+            slabEnd = other.slabEnd;
+            reserved = other.reserved;
+        }
+        other.freeList = other.freeTail = other.cursor = other.slabEnd = nullptr;
+        other.reserved = 0;
+    }
+
+    // Создание узла в свободном слоте
+    template <typename... Args>
+    T* create(Args&&... args) {
+        Slot* slot;
+        if (reserved > 0) { // Зарезервированные подряд слоты
+            --reserved;
+            slot = cursor++;
+        } else if (freeList != nullptr) { // Сначала - ранее освобожденные слоты
+            slot = freeList;
+            freeList = freeList->next;
+        } else {
+            if (cursor == slabEnd) { // Последняя пачка исчерпана - выделяем новую
+                slabs.emplace_back(new Slot[slabSlots]);
+                cursor = slabs.back().get();
+                slabEnd = cursor + slabSlots;
+            }
+            slot = cursor++;
+        }
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+
+    // Уничтожение узла и возврат слота в список свободных
+    void destroy(T* object) {
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->next = freeList;
+        if (freeList == nullptr) freeTail = slot;
+        freeList = slot;
+    }
+};
+
+// Класс двусвязного списка
+// Размер и указатель на средний элемент (индекс (size - 1) / 2) поддерживаются
+// при каждой вставке и удалении, поэтому pop_back и get работают за O(1)
+// splice и append_range не ищут новую середину: она помечается устаревшей (middlePtr == nullptr
+// при непустом списке) и находится первым вызовом get за O(size / 2)
+// NodeAllocator - стратегия выделения узлов (HeapAllocator или SlabAllocator)
+template <template <typename> class NodeAllocator>
+class BasicList {
 private:
     // Внутренняя структура узла списка
     struct Node {
         int value;    // Значение, хранящееся в узле
         Node* next;   // Указатель на следующий узел
+        Node* prev;   // Указатель на предыдущий узел
         
         // Конструктор узла
-        Node(int val) : value(val), next(nullptr) {} // Инициализация значения и нулевого указателя
+        Node(int val) : value(val), next(nullptr), prev(nullptr) {} // Инициализация значения и нулевых указателей
     };
     
-    // Указатели на начало и конец списка
-    Node* headPtr;  // Указатель на первый узел
-    Node* tailPtr;  // Указатель на последний узел
+    // Указатели на начало, конец и середину списка
+    Node* headPtr;      // Указатель на первый узел
+    Node* tailPtr;      // Указатель на последний узел
+    mutable Node* middlePtr;  // Указатель на средний узел (индекс (count - 1) / 2) или nullptr, если устарел
+    std::size_t count;  // Число элементов
+    NodeAllocator<Node> nodes;  // Выделение и освобождение узлов
 
 public:
+    // Двунаправленный итератор (позиция для splice, обход в range-for)
+    class iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = int*;
+        using reference = int&;
+
+        iterator() = default;
+        int& operator*() const { return node->value; }
+        iterator& operator++() { node = node->next; return *this; }
+        iterator operator++(int) { iterator old = *this; ++*this; return old; }
+        iterator& operator--() { node = node != nullptr ? node->prev : list->tailPtr; return *this; } // --end() - хвост
+        iterator operator--(int) { iterator old = *this; --*this; return old; }
+        bool operator==(const iterator& other) const { return node == other.node; }
+
+    private:
+        friend class BasicList;
+        iterator(Node* position, const BasicList* owner) : node(position), list(owner) {}
+        Node* node = nullptr;             // Текущий узел (nullptr - позиция после хвоста)
+        const BasicList* list = nullptr;  // Список (для перехода от end() к хвосту)
+    };
+
     // Конструктор по умолчанию
-    List() : headPtr(nullptr), tailPtr(nullptr) {} // Инициализация пустого списка
+    BasicList() : headPtr(nullptr), tailPtr(nullptr), middlePtr(nullptr), count(0) {} // Инициализация пустого списка
+    BasicList(const BasicList&) = delete;
+    BasicList& operator=(const BasicList&) = delete;
+
+    // Конструктор перемещения: узлы (и пул узлов) переходят без копирования, other становится пустым
+    BasicList(BasicList&& other) noexcept
+        : headPtr(std::exchange(other.headPtr, nullptr)), tailPtr(std::exchange(other.tailPtr, nullptr)),
+          middlePtr(std::exchange(other.middlePtr, nullptr)), count(std::exchange(other.count, 0)),
+          nodes(std::move(other.nodes)) {}
+
+    // Присваивание перемещением: текущие элементы освобождаются, узлы other переходят за O(1)
+    BasicList& operator=(BasicList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            headPtr = std::exchange(other.headPtr, nullptr);
+            tailPtr = std::exchange(other.tailPtr, nullptr);
+            middlePtr = std::exchange(other.middlePtr, nullptr);
+            count = std::exchange(other.count, 0);
+            nodes = std::move(other.nodes);
+        }
+        return *this;
+    }
+
+    iterator begin() const { return iterator(headPtr, this); }
+    iterator end() const { return iterator(nullptr, this); }
     
     // Метод проверки пустоты списка
     bool empty() const {
         return headPtr == nullptr; // Если headPtr равен nullptr, список пуст
     }
+
+    // Метод получения числа элементов
+    std::size_t size() const {
+        return count;
+    }
     
     // Метод вывода всех элементов списка
     void show() const {
@@ -38,38 +243,62 @@ public:
         std::cout << std::endl; // Переход на новую строку после вывода
     }
 
+    // Метод обхода: function(value) для каждого элемента от головы к хвосту
+    template <typename Function>
+    void for_each(Function function) const {
+        for (Node* iterator = headPtr; iterator != nullptr; iterator = iterator->next) {
+            function(iterator->value);
+        }
+    }
+
     // Метод добавления элемента в начало списка
     void push_front(int value) {
-        Node* newElement = new Node(value); // Создаем новый узел
+        Node* newElement = nodes.create(value); // Создаем новый узел
         if (!empty()) { // Если список не пуст
             newElement->next = headPtr; // Новый узел указывает на старую голову
+            headPtr->prev = newElement; // Старая голова ссылается назад на новый узел
             headPtr = newElement; // Голова теперь указывает на новый узел
+            // Индексы сдвинулись на 1; при нечетном размере середина смещается влево
+            if (middlePtr != nullptr && count % 2 == 1) middlePtr = middlePtr->prev;
         } else { // Если список пуст
             headPtr = newElement; // Голова указывает на новый узел
             tailPtr = newElement; // Хвост также указывает на новый узел
+            middlePtr = newElement; // Единственный элемент - средний
         }
+        ++count;
     }
 
     // Метод добавления элемента в конец списка
     void push_back(int value) {
-        Node* newElement = new Node(value); // Создаем новый узел
+        Node* newElement = nodes.create(value); // Создаем новый узел
         if (!empty()) { // Если список не пуст
             tailPtr->next = newElement; // Старый хвост указывает на новый узел
+            newElement->prev = tailPtr; // Новый узел ссылается назад на старый хвост
             tailPtr = newElement; // Хвост теперь указывает на новый узел
+            // При четном размере индекс середины увеличивается на 1
+            if (middlePtr != nullptr && count % 2 == 0) middlePtr = middlePtr->next;
         } else { // Если список пуст
             headPtr = newElement; // Голова указывает на новый узел
             tailPtr = newElement; // Хвост также указывает на новый узел
+            middlePtr = newElement; // Единственный элемент - средний
         }
+        ++count;
     }
 
     // Метод удаления элемента из начала списка
     void pop_front() {
         if (empty()) return; // Если список пуст, ничего не делаем
+        // Индексы сдвигаются на 1 влево; при четном размере середина смещается вправо
+        if (middlePtr != nullptr && count % 2 == 0) middlePtr = middlePtr->next;
         Node* nextElement = headPtr->next; // Сохраняем указатель на следующий узел
-        delete headPtr; // Освобождаем память текущей головы
+        nodes.destroy(headPtr); // Освобождаем память текущей головы
         headPtr = nextElement; // Голова теперь указывает на следующий узел
+        --count;
         if (headPtr == nullptr) { // Если список стал пустым
             tailPtr = nullptr; // Хвост также должен быть nullptr
+            middlePtr = nullptr; // Середины больше нет
+        } else {
+            headPtr->prev = nullptr; // У новой головы нет предыдущего узла
         }
     }
 
@@ -77,49 +306,906 @@ public:
     void pop_back() {
         if (empty()) return; // Если список пуст, ничего не делаем
         if (tailPtr == headPtr) { // Если в списке только один элемент
-            delete headPtr; // Освобождаем память
+            nodes.destroy(headPtr); // Освобождаем память
             tailPtr = nullptr; // Обнуляем хвост
             headPtr = nullptr; // Обнуляем голову
+            middlePtr = nullptr; // Обнуляем середину
+            count = 0;
             return; // Выходим из метода
         }
-        // Ищем предпоследний узел
-        Node* iterator = headPtr; // Начинаем с головы
-        while (iterator->next != tailPtr) { // Пока не дойдем до предпоследнего
-            iterator = iterator->next; // Переходим к следующему узлу
-        }
-        delete tailPtr; // Освобождаем память последнего узла
+        // При нечетном размере индекс середины уменьшается на 1
+        if (middlePtr != nullptr && count % 2 == 1) middlePtr = middlePtr->prev;
+        Node* iterator = tailPtr->prev; // Предпоследний узел известен по обратной ссылке
+        nodes.destroy(tailPtr); // Освобождаем память последнего узла
         tailPtr = iterator; // Хвост теперь указывает на предпоследний узел
         iterator->next = nullptr; // Новый конец списка указывает на nullptr
+        --count;
     }
 
     // Метод получения среднего элемента (медианы) списка
     int get() const {
         if (empty()) return -1; // Если список пуст, возвращаем -1
-        Node* fastPtr = headPtr; // Быстрый указатель (двигается на 2 шага)
-        Node* slowPtr = headPtr; // Медленный указатель (двигается на 1 шаг)
-        bool moveSlow = false;   // Флаг для перемещения медленного указателя
-        // Проходим по списку быстрым указателем
-        while (fastPtr->next != nullptr) {
-            if (moveSlow) {
-                slowPtr = slowPtr->next; // Перемещаем медленный указатель
+        if (middlePtr == nullptr) { // Середина устарела после splice/append_range - ищем с ближнего конца
+            std::size_t index = (count - 1) / 2;
+            if (index < count / 2) {
+                middlePtr = headPtr;
+                for (std::size_t i = 0; i < index; ++i) middlePtr = middlePtr->next;
+            } else {
+                middlePtr = tailPtr;
+                for (std::size_t i = count - 1; i > index; --i) middlePtr = middlePtr->prev;
+            }
+        }
+        return middlePtr->value; // Середина поддерживается при изменениях списка
+    }
+
+    // Метод удаления всех элементов
+    void clear() {
+        while (headPtr != nullptr) {
+            nodes.destroy(std::exchange(headPtr, headPtr->next));
+        }
+        tailPtr = middlePtr = nullptr;
+        count = 0;
+    }
+
+    // Перенос всех элементов other перед position за O(1); other становится пустым
+    // Для пула узлов пачки other переходят в пул этого списка (O(число пачек))
+    void splice(iterator position, BasicList& other) {
+        assert(&other != this);
+        if (other.empty()) return;
+        nodes.adopt(other.nodes);
+        Node* first = std::exchange(other.headPtr, nullptr);
+        Node* last = std::exchange(other.tailPtr, nullptr);
+        std::size_t moved = std::exchange(other.count, 0);
+        other.middlePtr = nullptr;
+        link(position.node, first, last, moved);
+    }
+
+    // Перенос отрезка [first, last) списка other (возможно, этого же) перед position за O(1)
+    // length - число элементов отрезка, известное вызывающему
+    // Только для стратегий без состояния: узлы пула нельзя передать другому списку поштучно
+    void splice(iterator position, BasicList& other, iterator first, iterator last, std::size_t length)
+        requires std::is_empty_v<NodeAllocator<Node>>
+    {
+        if (first == last) return;
+        Node* begin = first.node;
+        Node* end = last.node != nullptr ? last.node->prev : other.tailPtr; // Последний узел отрезка
+        // Вырезаем [begin, end] из other
+        (begin->prev != nullptr ? begin->prev->next : other.headPtr) = end->next;
+        (end->next != nullptr ? end->next->prev : other.tailPtr) = begin->prev;
+        begin->prev = end->next = nullptr;
+        other.count -= length;
+        other.middlePtr = nullptr;
+        link(position.node, begin, end, length);
+    }
+
+    // То же с подсчетом длины отрезка: O(длина отрезка), без выделений и копирования значений
+    void splice(iterator position, BasicList& other, iterator first, iterator last)
+        requires std::is_empty_v<NodeAllocator<Node>>
+    {
+        std::size_t length = 0;
+        for (iterator it = first; it != last; ++it) ++length;
+        splice(position, other, first, last, length);
+    }
+
+    // Присоединение other в конец за O(1)
+    void concatenate(BasicList& other) {
+        splice(end(), other);
+    }
+
+    // Добавление диапазона значений в конец: цепочка узлов строится отдельно и присоединяется целиком;
+    // для диапазона известного размера пул выделяет все узлы одной пачкой
+    template <std::ranges::input_range Range>
+    void append_range(Range&& values) {
+        if constexpr (std::ranges::sized_range<Range>) {
+            nodes.reserve(static_cast<std::size_t>(std::ranges::size(values)));
+        }
+        Node* first = nullptr;
+        Node* last = nullptr;
+        std::size_t added = 0;
+        for (auto&& value : values) {
+            Node* newElement = nodes.create(static_cast<int>(value));
+            newElement->prev = last;
+            (last != nullptr ? last->next : first) = newElement;
+            last = newElement;
+            ++added;
+        }
+        if (added > 0) link(nullptr, first, last, added);
+    }
+    
+    // Сортировка по неубыванию перевязкой узлов: слияние естественных серий снизу вверх
+    // Серии (неубывающие или строго убывающие с разворотом, короткие дополняются вставками
+    // до minRun) кладутся в стек; две верхние сливаются, пока нижняя не станет больше верхней
+    // более чем вдвое. Длины в стеке растут геометрически, поэтому стек ограничен 66 записями
+    // (O(1) памяти), а сливаются соседние серии близкой длины, пока они еще в кэше.
+    // Упорядоченный список обрабатывается за один проход; сортировка устойчива
+    void sort() {
+        if (count < 2) return;
+        Run stack[66];
+        std::size_t depth = 0;
+        Node* rest = headPtr;
+        while (rest != nullptr) {
+            stack[depth++] = takeRun(rest);
+            while (depth >= 2 && stack[depth - 2].length <= 2 * stack[depth - 1].length) {
+                stack[depth - 2] = merge(stack[depth - 2], stack[depth - 1]);
+                --depth;
             }
-            moveSlow = !moveSlow; // Инвертируем флаг (чередуем шаги)
-            fastPtr = fastPtr->next; // Всегда перемещаем быстрый указатель
         }
-        return slowPtr->value; // Возвращаем значение среднего элемента
+        while (depth >= 2) {
+            stack[depth - 2] = merge(stack[depth - 2], stack[depth - 1]);
+            --depth;
+        }
+        // Восстановление обратных ссылок, хвоста и середины
+        Node* previous = nullptr;
+        std::size_t index = 0, middleIndex = (count - 1) / 2;
+        for (Node* node = stack[0].head; node != nullptr; previous = node, node = node->next, ++index) {
+            node->prev = previous;
+            if (index == middleIndex) middlePtr = node;
+        }
+        headPtr = stack[0].head;
+        tailPtr = previous;
     }
     
     // Деструктор - освобождает всю память
-    ~List() {
-        // Последовательно удаляем все элементы с начала
-        while (!empty()) {
-            pop_front(); // Удаляем первый элемент
+    ~BasicList() {
+        clear();
+    }
+
+private:
+    // Упорядоченная серия для sort: цепочка [head, tail], завершенная nullptr
+    struct Run {
+        Node* head;
+        Node* tail;
+        std::size_t length;
+    };
+
+    static constexpr std::size_t minRun = 32;  // Минимальная длина серии (короче - дополняется вставками)
+
+    // Отделение очередной серии от начала цепочки rest
+    static Run takeRun(Node*& rest) {
+        Node* head = rest;
+        Node* tail = head;
+        Node* next = head->next;
+        std::size_t length = 1;
+        if (next != nullptr && next->value < head->value) { // Строго убывающая серия - разворачиваем
+            head->next = nullptr;
+            while (next != nullptr && next->value < head->value) {
+                Node* after = next->next;
+                next->next = head;
+                head = next;
+                next = after;
+                ++length;
+            }
+        } else { // Неубывающая серия
+            while (next != nullptr && tail->value <= next->value) {
+                tail = next;
+                next = next->next;
+                ++length;
+                if (next != nullptr) __builtin_prefetch(next->next); // Узел через один
+            }
+            tail->next = nullptr;
+        }
+        // Дополнение короткой серии вставками (после равных - устойчивость)
+        while (length < minRun && next != nullptr) {
+            Node* node = next;
+            next = next->next;
+            if (tail->value <= node->value) {
+                tail->next = node;
+                tail = node;
+                node->next = nullptr;
+            } else if (node->value < head->value) {
+                node->next = head;
+                head = node;
+            } else {
+                Node* position = head;
+                while (position->next->value <= node->value) position = position->next;
+                node->next = position->next;
+                position->next = node;
+            }
+            ++length;
+        }
+        rest = next;
+        return {head, tail, length};
+    }
+
+    // Слияние соседних серий first (левая) и second (правая)
+    static Run merge(Run first, Run second) {
+        Run result{nullptr, nullptr, first.length + second.length};
+        if (first.tail->value <= second.head->value) { // Серии уже упорядочены - только склейка
+            first.tail->next = second.head;
+            result.head = first.head;
+            result.tail = second.tail;
+            return result;
+        }
+        Node** link = &result.head;
+        Node* left = first.head;
+        Node* right = second.head;
+        while (true) {
+            if (right->value < left->value) { // Строгое сравнение - устойчивость
+                *link = right;
+                link = &right->next;
+                right = right->next;
+                if (right == nullptr) {
+                    *link = left;
+                    result.tail = first.tail;
+                    return result;
+                }
+                __builtin_prefetch(right->next);
+            } else {
+                *link = left;
+                link = &left->next;
+                left = left->next;
+                if (left == nullptr) {
+                    *link = right;
+                    result.tail = second.tail;
+                    return result;
+                }
+                __builtin_prefetch(left->next);
+            }
+        }
+    }
+
+    // Вставка готовой цепочки [first, last] из length узлов перед position (nullptr - в конец)
+    void link(Node* position, Node* first, Node* last, std::size_t length) {
+        Node* before = position != nullptr ? position->prev : tailPtr;
+        first->prev = before;
+        last->next = position;
+        (before != nullptr ? before->next : headPtr) = first;
+        (position != nullptr ? position->prev : tailPtr) = last;
+        count += length;
+        middlePtr = nullptr; // Середина будет найдена при следующем get
+    }
+};
+
+// Список с отдельным выделением каждого узла
+using List = BasicList<HeapAllocator>;
+// Список с узлами из пачек пула
+using PooledList = BasicList<SlabAllocator>;
+
+// Развернутый (unrolled) двусвязный список: узел размером в кэш-линию хранит до capacity значений
+// Элементы узла занимают отрезок [first, last) массива values: push_back дописывает справа,
+// push_front - слева, поэтому обе операции O(1). Узлы выделяются из SlabAllocator
+class UnrolledList {
+private:
+    static constexpr std::size_t cacheLine = 64;
+    // Сколько int помещается в кэш-линию рядом с двумя указателями и двумя индексами
+    static constexpr std::size_t capacity = (cacheLine - 2 * sizeof(void*) - 2) / sizeof(int);
+
+    struct alignas(cacheLine) Node {
+        Node* next = nullptr;           // Следующий узел
+        Node* prev = nullptr;           // Предыдущий узел
+        unsigned char first = 0;        // Начало занятого отрезка
+        unsigned char last = 0;         // Конец занятого отрезка
+        int values[capacity];           // Значения
+    };
+    static_assert(sizeof(Node) == cacheLine);
+
+    Node* headPtr = nullptr;         // Первый узел
+    Node* tailPtr = nullptr;         // Последний узел
+    std::size_t count = 0;           // Число элементов
+    SlabAllocator<Node> nodes;       // Пул узлов
+
+public:
+    UnrolledList() = default;
+    UnrolledList(const UnrolledList&) = delete;
+    UnrolledList& operator=(const UnrolledList&) = delete;
+
+    bool empty() const { return count == 0; }
+    std::size_t size() const { return count; }
+
+    // Добавление в начало: свободное место слева в первом узле или новый узел, заполняемый справа налево
+    void push_front(int value) {
+        if (headPtr == nullptr || headPtr->first == 0) {
+            Node* node = nodes.create();
+            node->first = node->last = capacity;
+            node->next = headPtr;
+            if (headPtr != nullptr) headPtr->prev = node;
+            else tailPtr = node;
+            headPtr = node;
+        }
+        headPtr->values[--headPtr->first] = value;
+        ++count;
+    }
+
+    // Добавление в конец: свободное место справа в последнем узле или новый узел
+    void push_back(int value) {
+        if (tailPtr == nullptr || tailPtr->last == capacity) {
+            Node* node = nodes.create();
+            node->prev = tailPtr;
+            if (tailPtr != nullptr) tailPtr->next = node;
+            else headPtr = node;
+            tailPtr = node;
+        }
+        tailPtr->values[tailPtr->last++] = value;
+        ++count;
+    }
+
+    // Удаление из начала; опустевший узел возвращается в пул
+    void pop_front() {
+        if (empty()) return;
+        ++headPtr->first;
+        --count;
+        if (headPtr->first == headPtr->last) unlink(headPtr);
+    }
+
+    // Удаление из конца; опустевший узел возвращается в пул
+    void pop_back() {
+        if (empty()) return;
+        --tailPtr->last;
+        --count;
+        if (tailPtr->first == tailPtr->last) unlink(tailPtr);
+    }
+
+    // Средний элемент (индекс (size - 1) / 2): проход по узлам с ближнего конца, O(size / capacity)
+    int get() const {
+        if (empty()) return -1;
+        std::size_t index = (count - 1) / 2;
+        if (index < count / 2) { // Середина в первой половине - идем с головы
+            for (Node* node = headPtr;; node = node->next) {
+                std::size_t used = node->last - node->first;
+                if (index < used) return node->values[node->first + index];
+                index -= used;
+            }
+        }
+        std::size_t fromBack = count - 1 - index; // Иначе - с хвоста
+        for (Node* node = tailPtr;; node = node->prev) {
+            std::size_t used = node->last - node->first;
+            if (fromBack < used) return node->values[node->last - 1 - fromBack];
+            fromBack -= used;
         }
     }
+
+    // Обход: function(value) для каждого элемента от головы к хвосту
+    template <typename Function>
+    void for_each(Function function) const {
+        for (Node* node = headPtr; node != nullptr; node = node->next) {
+            for (unsigned i = node->first; i < node->last; ++i) function(node->values[i]);
+        }
+    }
+
+    // Вывод всех элементов
+    void show() const {
+        for_each([](int value) { std::cout << value << " "; });
+        std::cout << std::endl;
+    }
+
+    ~UnrolledList() {
+        while (headPtr != nullptr) unlink(headPtr);
+    }
+
+private:
+    // Исключение узла из цепочки и возврат в пул
+    void unlink(Node* node) {
+        (node->prev != nullptr ? node->prev->next : headPtr) = node->next;
+        (node->next != nullptr ? node->next->prev : tailPtr) = node->prev;
+        nodes.destroy(node);
+    }
 };
 
+// Бенчмарк слияния очередей: k списков по size / k элементов сливаются в один
+// поэлементным переносом (pop_front + push_back) и через concatenate; append_range против push_back
+void benchmarkMerge(std::size_t size, std::size_t parts) {
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    auto makeParts = [&] {
+        std::vector<List> lists(parts);
+        for (std::size_t i = 0; i < size; ++i) lists[i % parts].push_back(static_cast<int>(i));
+        return lists;
+    };
+
+    auto lists = makeParts();
+    List merged;
+    double copyTime = measure([&] {
+        for (auto& list : lists) {
+            while (!list.empty()) {
+                merged.push_back(*list.begin());
+                list.pop_front();
+            }
+        }
+    });
+    assert(merged.size() == size);
+    lists = makeParts();
+    List spliced;
+    double spliceTime = measure([&] {
+        for (auto& list : lists) spliced.concatenate(list);
+    });
+    assert(spliced.size() == size && merged.get() == spliced.get());
+
+    std::vector<int> source(size);
+    for (std::size_t i = 0; i < size; ++i) source[i] = static_cast<int>(i);
+    List pushed;
+    PooledList pooledPushed, pooledAppended;
+    double pushTime = measure([&] {
+        for (int value : source) pushed.push_back(value);
+    });
+    double pooledPushTime = measure([&] {
+        for (int value : source) pooledPushed.push_back(value);
+    });
+    double appendTime = measure([&] {
+        pooledAppended.append_range(source);
+    });
+    assert(pooledAppended.get() == pushed.get());
+    std::cout << size << " elements in " << parts << " lists, merge (ms): element by element " << copyTime
+              << ", concatenate " << spliceTime << "; fill: push_back " << pushTime << ", pooled push_back "
+              << pooledPushTime << ", pooled append_range " << appendTime << std::endl;
+}
+
+// Бенчмарк сортировки списка: sort() против копирования значений в массив, std::sort и записи обратно
+// Размеры 1e6, 1e7, ... до maxSize; случайные значения и почти упорядоченные (серии по 1000)
+void benchmarkSort(std::size_t maxSize) {
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    std::mt19937 random_generator(42);
+    for (std::size_t size = 1'000'000; size <= maxSize; size *= 10) {
+        for (bool nearlySorted : {false, true}) {
+            std::vector<int> source(size);
+            for (std::size_t i = 0; i < size; ++i) {
+                source[i] = nearlySorted ? static_cast<int>(i % 1000 == 0 ? random_generator() % size : i)
+                                         : static_cast<int>(random_generator());
+            }
+            double copyTime, sortTime;
+            {
+                List list;
+                list.append_range(source);
+                copyTime = measure([&] {
+                    std::vector<int> buffer(list.begin(), list.end());
+                    std::sort(buffer.begin(), buffer.end());
+                    std::copy(buffer.begin(), buffer.end(), list.begin());
+                });
+            }
+            {
+                List list;
+                list.append_range(source);
+                sortTime = measure([&] { list.sort(); });
+                assert(std::is_sorted(list.begin(), list.end()));
+            }
+            std::cout << size << (nearlySorted ? " nearly sorted" : " random") << " elements, sort (ms): copy out + std::sort "
+                      << copyTime << ", List::sort " << sortTime << std::endl;
+        }
+    }
+}
+
+// Хеш-указатели (hazard pointers) для безопасного освобождения узлов конкурентных структур
+// Поток публикует указатель в своем слоте перед разыменованием; удаленный из структуры узел
+// откладывается (retire) и освобождается, только когда его нет ни в одном слоте
+class HazardPointers {
+public:
+    static constexpr std::size_t maxThreads = 512;       // Число записей (одновременно живущих потоков)
+    static constexpr std::size_t slotsPerThread = 2;     // Слотов на поток
+    static constexpr std::size_t scanThreshold = 2 * maxThreads * slotsPerThread;  // Порог сканирования
+
+    // Чтение source с публикацией значения в слоте index; повтор, пока source не перестанет меняться
+    template <typename T>
+    static T* protect(std::size_t index, const std::atomic<T*>& source) {
+        std::atomic<void*>& slot = local().record->hazards[index];
+        T* pointer = source.load(std::memory_order_acquire);
+        while (true) {
+            slot.store(pointer); // seq_cst: публикация видна до повторного чтения source
+            T* current = source.load();
+            if (current == pointer) return pointer;
+            pointer = current;
+        }
+    }
+
+    // Снятие защиты со слота index
+    static void clear(std::size_t index) {
+        local().record->hazards[index].store(nullptr, std::memory_order_release);
+    }
+
+    // Отложенное удаление объекта, исключенного из структуры
+    template <typename T>
+    static void retire(T* object) {
+        Local& state = local();
+        state.retired.push_back({object, [](void* pointer) { delete static_cast<T*>(pointer); }});
+        if (state.retired.size() >= scanThreshold) scan(state.retired);
+    }
+
+private:
+    // Запись потока: слоты на отдельной кэш-линии
+    struct alignas(64) Record {
+        std::atomic<void*> hazards[slotsPerThread] = {};
+        std::atomic<bool> busy{false};
+    };
+
+    // Отложенный объект и функция его удаления
+    struct Retired {
+        void* pointer;
+        void (*deleter)(void*);
+    };
+
+    // Объекты, оставшиеся защищенными при завершении своих потоков
+    struct Orphans {
+        std::mutex mutex;
+        std::vector<Retired> retired;
+        ~Orphans() { // К завершению программы защищенных указателей нет
+            for (auto& item : retired) item.deleter(item.pointer);
+        }
+    };
+
+    // Состояние потока: занятая запись и его отложенные объекты
+    struct Local {
+        Record* record;
+        std::vector<Retired> retired;
+
+        Local() : record(acquire()) { orphans(); } // Список создается раньше, чем понадобится в деструкторе
+        ~Local() {
+            for (auto& hazard : record->hazards) hazard.store(nullptr);
+            scan(retired);
+            if (!retired.empty()) {
+                std::lock_guard lock(orphans().mutex);
+                orphans().retired.insert(orphans().retired.end(), retired.begin(), retired.end());
+            }
+            record->busy.store(false, std::memory_order_release);
+        }
+    };
+
+    // Общие записи и объекты завершившихся потоков
+    static Record* records() {
+        static Record table[maxThreads];
+        return table;
+    }
+    static Orphans& orphans() {
+        static Orphans list;
+        return list;
+    }
+
+    static Local& local() {
+        thread_local Local state;
+        return state;
+    }
+
+    // Захват свободной записи
+    static Record* acquire() {
+        for (std::size_t i = 0; i < maxThreads; ++i) {
+            Record& record = records()[i];
+            bool expected = false;
+            if (!record.busy.load(std::memory_order_relaxed) && record.busy.compare_exchange_strong(expected, true)) return &record;
+        }
+        throw std::runtime_error("HazardPointers: too many threads");
+    }
+
+    // Освобождение отложенных объектов, которых нет ни в одном слоте
+    static void scan(std::vector<Retired>& retired) {
+        std::vector<void*> protectedPointers;
+        for (std::size_t i = 0; i < maxThreads; ++i) {
+            for (auto& hazard : records()[i].hazards) {
+                if (void* pointer = hazard.load(); pointer != nullptr) protectedPointers.push_back(pointer);
+            }
+        }
+        std::sort(protectedPointers.begin(), protectedPointers.end());
+        std::size_t kept = 0;
+        for (auto& item : retired) {
+            if (std::binary_search(protectedPointers.begin(), protectedPointers.end(), item.pointer)) retired[kept++] = item;
+            else item.deleter(item.pointer);
+        }
+        retired.resize(kept);
+    }
+};
+
+// Неограниченная конкурентная очередь Майкла-Скотта (MPMC, lock-free)
+// Интерфейс очереди List: push_back, pop_front, empty. Голова - фиктивный узел,
+// значение берется из следующего за ним; старые головы освобождаются через HazardPointers
+template <typename T>
+class ConcurrentQueue {
+private:
+    struct Node {
+        T value{};
+        std::atomic<Node*> next{nullptr};
+        Node() = default;
+        explicit Node(const T& val) : value(val) {}
+    };
+
+    alignas(64) std::atomic<Node*> headPtr;  // Фиктивный узел (читают потребители)
+    alignas(64) std::atomic<Node*> tailPtr;  // Последний или предпоследний узел (пишут производители)
+
+public:
+    ConcurrentQueue() {
+        Node* dummy = new Node();
+        headPtr.store(dummy);
+        tailPtr.store(dummy);
+    }
+    ConcurrentQueue(const ConcurrentQueue&) = delete;
+    ConcurrentQueue& operator=(const ConcurrentQueue&) = delete;
+
+    // Добавление в конец
+    void push_back(const T& value) {
+        Node* newElement = new Node(value);
+        while (true) {
+            Node* last = HazardPointers::protect(0, tailPtr);
+            Node* next = last->next.load(std::memory_order_acquire);
+            if (next == nullptr) { // last - действительно последний: присоединяем узел
+                if (last->next.compare_exchange_weak(next, newElement, std::memory_order_release, std::memory_order_relaxed)) {
+                    tailPtr.compare_exchange_strong(last, newElement, std::memory_order_release, std::memory_order_relaxed);
+                    break;
+                }
+            } else { // Хвост отстал - помогаем его продвинуть
+                tailPtr.compare_exchange_strong(last, next, std::memory_order_release, std::memory_order_relaxed);
+            }
+        }
+        HazardPointers::clear(0);
+    }
+
+    // Извлечение из начала; std::nullopt, если очередь пуста
+    std::optional<T> pop_front() {
+        while (true) {
+            Node* first = HazardPointers::protect(0, headPtr);
+            Node* next = HazardPointers::protect(1, first->next);
+            if (first != headPtr.load()) continue; // Голова сменилась - next мог быть уже освобожден
+            if (next == nullptr) {
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                return std::nullopt;
+            }
+            Node* last = tailPtr.load(std::memory_order_acquire);
+            if (first == last) { // Хвост отстал от присоединенного узла
+                tailPtr.compare_exchange_strong(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            T value = next->value; // Копия до CAS: после него узел может забрать другой поток
+            if (headPtr.compare_exchange_strong(first, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                HazardPointers::retire(first);
+                return value;
+            }
+        }
+    }
+
+    // Проверка пустоты (мгновенный снимок)
+    bool empty() const {
+        Node* first = HazardPointers::protect(0, headPtr);
+        bool result = first->next.load(std::memory_order_acquire) == nullptr;
+        HazardPointers::clear(0);
+        return result;
+    }
+
+    // Деструктор: к этому моменту других потоков у очереди нет
+    ~ConcurrentQueue() {
+        Node* iterator = headPtr.load();
+        while (iterator != nullptr) {
+            Node* next = iterator->next.load();
+            delete iterator;
+            iterator = next;
+        }
+    }
+};
+
+// Ограниченная конкурентная очередь на кольцевом буфере (MPMC, схема Вьюкова)
+// У каждой ячейки есть номер: равен позиции записи, когда ячейка свободна, и позиции + 1,
+// когда в ней значение. Производители и потребители захватывают позиции CAS-ом,
+// выделения памяти на операцию нет
+template <typename T>
+class BoundedQueue {
+private:
+    struct alignas(64) Cell {
+        std::atomic<std::uint64_t> sequence;
+        T value;
+    };
+
+    std::size_t mask;                                   // Емкость - 1 (емкость - степень двойки)
+    std::unique_ptr<Cell[]> cells;                      // Кольцевой буфер
+    alignas(64) std::atomic<std::uint64_t> tailPos{0};  // Следующая позиция записи
+    alignas(64) std::atomic<std::uint64_t> headPos{0};  // Следующая позиция чтения
+
+public:
+    // Емкость округляется вверх до степени двойки
+    explicit BoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) size *= 2;
+        mask = size - 1;
+        cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    std::size_t capacity() const { return mask + 1; }
+
+    // Добавление в конец; false, если очередь заполнена
+    bool push_back(const T& value) {
+        std::uint64_t position = tailPos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[position & mask];
+            std::uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::int64_t>(sequence - position);
+            if (difference == 0) { // Ячейка свободна - пытаемся занять позицию
+                if (tailPos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (difference < 0) { // Ячейку еще не освободил потребитель с прошлого круга
+                return false;
+            } else { // Позицию занял другой производитель
+                position = tailPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Извлечение из начала; std::nullopt, если очередь пуста
+    std::optional<T> pop_front() {
+        std::uint64_t position = headPos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[position & mask];
+            std::uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+            auto difference = static_cast<std::int64_t>(sequence - (position + 1));
+            if (difference == 0) { // В ячейке значение - пытаемся занять позицию
+                if (headPos.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    T value = std::move(cell.value);
+                    cell.sequence.store(position + mask + 1, std::memory_order_release); // Свободна для следующего круга
+                    return value;
+                }
+            } else if (difference < 0) { // Значение еще не записано
+                return std::nullopt;
+            } else { // Позицию занял другой потребитель
+                position = headPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Проверка пустоты (мгновенный снимок)
+    bool empty() const {
+        return headPos.load(std::memory_order_acquire) >= tailPos.load(std::memory_order_acquire);
+    }
+};
+
+// Бенчмарк конкурентной очереди: producers производителей отправляют total отметок времени,
+// consumers потребителей их забирают. Пропускная способность и перцентили задержки
+// от push_back до pop_front. Ожидание - через yield (потоков может быть больше, чем ядер)
+template <typename Queue>
+void benchmarkQueue(const char* title, Queue& queue, std::size_t producers, std::size_t consumers, std::size_t total) {
+    using Clock = std::chrono::steady_clock;
+    std::atomic<std::size_t> consumed{0};
+    std::vector<std::vector<long long>> latencies(consumers);
+    std::vector<std::thread> threads;
+
+    auto begin = Clock::now();
+    for (std::size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            std::size_t share = total / producers + (p < total % producers ? 1 : 0);
+            for (std::size_t i = 0; i < share; ++i) {
+                long long stamp = Clock::now().time_since_epoch().count();
+                while (!queue.push_back(stamp)) std::this_thread::yield();
+            }
+        });
+    }
+    for (std::size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&, c] {
+            auto& samples = latencies[c];
+            samples.reserve(total / consumers + 1);
+            while (consumed.load(std::memory_order_relaxed) < total) {
+                if (auto stamp = queue.pop_front()) {
+                    samples.push_back(Clock::now().time_since_epoch().count() - *stamp);
+                    consumed.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+    std::vector<long long> all;
+    for (auto& samples : latencies) all.insert(all.end(), samples.begin(), samples.end());
+    assert(all.size() == total);
+    std::sort(all.begin(), all.end());
+    auto percentile = [&](double fraction) { return all[static_cast<std::size_t>(fraction * (all.size() - 1))] / 1000.0; };
+    std::cout << "  " << title << " " << producers << "P/" << consumers << "C: " << total / seconds / 1e6 << " Mops/s, latency us p50 "
+              << percentile(0.5) << " p99 " << percentile(0.99) << " p99.9 " << percentile(0.999) << std::endl;
+}
+
+// Бенчмарк очередей на 1, 2, 4, ..., maxThreads производителях и потребителях
+void benchmarkConcurrent(std::size_t total, std::size_t maxThreads) {
+    // Адаптер: push_back очереди Майкла-Скотта всегда успешен
+    struct Unbounded {
+        ConcurrentQueue<long long> queue;
+        bool push_back(long long value) { queue.push_back(value); return true; }
+        std::optional<long long> pop_front() { return queue.pop_front(); }
+    };
+    std::cout << total << " items, throughput and push-to-pop latency:" << std::endl;
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        {
+            Unbounded queue;
+            benchmarkQueue("Michael-Scott", queue, threads, threads, total);
+        }
+        {
+            BoundedQueue<long long> queue(1 << 14);
+            benchmarkQueue("ring buffer  ", queue, threads, threads, total);
+        }
+    }
+}
+
+// Бенчмарк операций списка на size элементах
+void benchmark(std::size_t size) {
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    List list;
+    long long checksum = 0;
+    double pushTime = measure([&] {
+        for (std::size_t i = 0; i < size; ++i) {
+            if (i % 2 == 0) list.push_back(static_cast<int>(i));
+            else list.push_front(static_cast<int>(i));
+        }
+    });
+    double middleTime = measure([&] {
+        for (std::size_t i = 0; i < size; ++i) checksum += list.get();
+    });
+    // Чередование pop_back и get: раньше каждая операция была O(n)
+    double popTime = measure([&] {
+        while (!list.empty()) {
+            list.pop_back();
+            checksum += list.get();
+        }
+    });
+    std::cout << size << " elements (ms): push " << pushTime << ", get x" << size << " " << middleTime
+              << ", pop_back + get " << popTime << " [checksum " << checksum << "]" << std::endl;
+}
+
+// Бенчмарк хранения узлов: отдельные new/delete, пул узлов, развернутый список и std::vector
+// Заполнение, три прохода по элементам, затем удаление с конца
+void benchmarkStorage(std::size_t size) {
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+
+    long long checksum = 0;
+    auto run = [&](const char* title, auto& container) {
+        double pushTime = measure([&] {
+            for (std::size_t i = 0; i < size; ++i) container.push_back(static_cast<int>(i));
+        });
+        double traverseTime = measure([&] {
+            for (int pass = 0; pass < 3; ++pass) {
+                if constexpr (requires { container.for_each([](int) {}); }) {
+                    container.for_each([&](int value) { checksum += value; });
+                } else {
+                    for (int value : container) checksum += value;
+                }
+            }
+        });
+        double popTime = measure([&] {
+            while (!container.empty()) container.pop_back();
+        });
+        std::cout << " " << title << " " << pushTime << " / " << traverseTime << " / " << popTime << ";";
+    };
+
+    std::cout << size << " elements, push_back / 3 traversals / pop_back (ms):";
+    {
+        List list;
+        run("list", list);
+    }
+    {
+        PooledList list;
+        run("pooled list", list);
+    }
+    {
+        UnrolledList list;
+        run("unrolled list", list);
+    }
+    {
+        std::vector<int> vector;
+        run("vector", vector);
+    }
+    std::cout << " [checksum " << checksum << "]" << std::endl;
+}
+
 // Главная функция программы
-int main() {
+int main(int argc, char* argv[]) {
     List testList; // Создаем тестовый список
     assert(testList.empty()); // Проверяем, что список пуст
     testList.push_back(1); // Добавляем элемент в конец
@@ -155,5 +1241,210 @@ int main() {
     assert(testList.get() == 1); // Проверяем средний элемент для 2 элементов
     std::cout << "The middle element for size 2 is correct" << std::endl;
 
+    // Случайные операции в сравнении с std::deque: размер и середина после каждой операции
+    std::mt19937 random_generator(42);
+    std::deque<int> reference;
+    while (!testList.empty()) testList.pop_front();
+    for (int step = 0; step < 100'000; ++step) {
+        int value = static_cast<int>(random_generator() % 1000);
+        switch (random_generator() % 5) {
+        case 0: testList.push_front(value); reference.push_front(value); break;
+        case 1: case 2: testList.push_back(value); reference.push_back(value); break;
+        case 3: testList.pop_front(); if (!reference.empty()) reference.pop_front(); break;
+        default: testList.pop_back(); if (!reference.empty()) reference.pop_back(); break;
+        }
+        assert(testList.size() == reference.size());
+        assert(testList.get() == (reference.empty() ? -1 : reference[(reference.size() - 1) / 2]));
+    }
+    std::cout << "size() and get() match std::deque on random operations" << std::endl;
+
+    // Те же случайные операции для списка из пула и развернутого списка
+    {
+        PooledList pooled;
+        UnrolledList unrolled;
+        reference.clear();
+        for (int step = 0; step < 100'000; ++step) {
+            int value = static_cast<int>(random_generator() % 1000);
+            switch (random_generator() % 5) {
+            case 0: pooled.push_front(value); unrolled.push_front(value); reference.push_front(value); break;
+            case 1: case 2: pooled.push_back(value); unrolled.push_back(value); reference.push_back(value); break;
+            case 3: pooled.pop_front(); unrolled.pop_front(); if (!reference.empty()) reference.pop_front(); break;
+            default: pooled.pop_back(); unrolled.pop_back(); if (!reference.empty()) reference.pop_back(); break;
+            }
+            int middle = reference.empty() ? -1 : reference[(reference.size() - 1) / 2];
+            assert(pooled.size() == reference.size() && unrolled.size() == reference.size());
+            assert(pooled.get() == middle && unrolled.get() == middle);
+        }
+        std::vector<int> pooledValues, unrolledValues;
+        pooled.for_each([&](int value) { pooledValues.push_back(value); });
+        unrolled.for_each([&](int value) { unrolledValues.push_back(value); });
+        assert(pooledValues == std::vector<int>(reference.begin(), reference.end()));
+        assert(unrolledValues == pooledValues);
+    }
+    std::cout << "PooledList and UnrolledList match std::deque on random operations" << std::endl;
+
+    // Тестирование перемещения, splice и append_range
+    auto values = [](const auto& list) { return std::vector<int>(list.begin(), list.end()); };
+    {
+        List first, second;
+        first.append_range(std::vector<int>{1, 2, 3});
+        second.append_range(std::views::iota(10, 15) | std::views::filter([](int value) { return value % 2 == 0; }));
+        assert(values(second) == std::vector<int>({10, 12, 14}) && second.size() == 3);
+
+        List moved(std::move(first)); // Конструктор перемещения
+        assert(first.empty() && first.size() == 0 && first.get() == -1);
+        assert(values(moved) == std::vector<int>({1, 2, 3}) && moved.get() == 2);
+        first = std::move(moved); // Присваивание перемещением
+        assert(moved.empty() && values(first) == std::vector<int>({1, 2, 3}));
+
+        first.splice(++first.begin(), second); // Вставка целого списка в середину
+        assert(second.empty() && values(first) == std::vector<int>({1, 10, 12, 14, 2, 3}));
+        assert(first.size() == 6 && first.get() == 12);
+        first.push_front(0); // Середина восстановлена get и снова поддерживается
+        assert(first.get() == 12);
+        first.pop_back();
+        first.pop_back();
+        assert(first.get() == 10 && values(first) == std::vector<int>({0, 1, 10, 12, 14}));
+
+        // Перенос отрезка [10, 14) в начало другого списка и внутри одного списка
+        second.push_back(100);
+        auto from = std::next(first.begin(), 2), to = std::next(first.begin(), 4);
+        second.splice(second.begin(), first, from, to);
+        assert(values(second) == std::vector<int>({10, 12, 100}) && second.size() == 3 && second.get() == 12);
+        assert(values(first) == std::vector<int>({0, 1, 14}) && first.size() == 3 && first.get() == 1);
+        first.splice(first.begin(), first, std::prev(first.end()), first.end(), 1);
+        assert(values(first) == std::vector<int>({14, 0, 1}) && first.get() == 0);
+        first.concatenate(second);
+        assert(values(first) == std::vector<int>({14, 0, 1, 10, 12, 100}) && second.empty());
+        assert(first.get() == 1 && *--first.end() == 100);
+    }
+    {
+        // Пул узлов: после splice узлы и свободные слоты other принадлежат пулу приемника
+        PooledList target, source;
+        for (int i = 0; i < 5'000; ++i) source.push_back(i);
+        for (int i = 0; i < 1'000; ++i) source.pop_front(); // Свободные слоты в пуле source
+        target.append_range(std::vector<int>(3, -1));
+        target.concatenate(source);
+        assert(source.empty() && target.size() == 4'003 && target.get() == 2'998);
+        for (int i = 0; i < 2'000; ++i) target.push_back(i); // Переиспользуются слоты из пула source
+        source.push_back(7); // Исходный список по-прежнему работает с пустым пулом
+        assert(values(source) == std::vector<int>({7}));
+        PooledList moved = std::move(target);
+        assert(moved.size() == 6'003 && moved.get() == 3'998 && target.empty());
+    }
+    std::cout << "move, splice and append_range tests passed" << std::endl;
+
+    // Тестирование sort: случайные данные с повторами, устойчивость, граничные случаи
+    {
+        for (int size : {0, 1, 2, 3, 7, 100, 1'000, 65'537}) {
+            List list;
+            std::vector<int> expected;
+            for (int i = 0; i < size; ++i) {
+                int value = static_cast<int>(random_generator() % 100);
+                list.push_back(value);
+                expected.push_back(value);
+            }
+            list.sort();
+            std::sort(expected.begin(), expected.end());
+            assert(values(list) == expected && list.size() == expected.size());
+            assert(list.get() == (expected.empty() ? -1 : expected[(expected.size() - 1) / 2]));
+            // Обратные ссылки восстановлены: обход с хвоста дает обратный порядок
+            std::vector<int> backwards;
+            for (auto it = list.end(); it != list.begin();) backwards.push_back(*--it);
+            assert(std::equal(backwards.rbegin(), backwards.rend(), expected.begin(), expected.end()));
+        }
+        // Устойчивость: равные значения сохраняют порядок узлов (проверка по адресам через итераторы)
+        List list;
+        list.append_range(std::vector<int>{3, 1, 2, 1, 3, 1});
+        std::vector<int*> ones;
+        for (auto it = list.begin(); it != list.end(); ++it) if (*it == 1) ones.push_back(&*it);
+        list.sort();
+        assert(values(list) == std::vector<int>({1, 1, 1, 2, 3, 3}));
+        auto it = list.begin();
+        for (int* node : ones) assert(&*it++ == node);
+        // Список продолжает работать после сортировки
+        list.push_front(0);
+        list.pop_back();
+        assert(values(list) == std::vector<int>({0, 1, 1, 1, 2, 3}) && list.get() == 1);
+        // Убывающий список - худший случай для естественных серий
+        List descending;
+        for (int i = 1'000; i > 0; --i) descending.push_back(i);
+        descending.sort();
+        assert(std::is_sorted(descending.begin(), descending.end()) && *descending.begin() == 1);
+    }
+    std::cout << "sort() tests passed" << std::endl;
+
+    // Тестирование конкурентных очередей: 4 производителя, 4 потребителя
+    // Каждое значение получено ровно один раз, порядок значений одного производителя сохранен
+    auto testConcurrent = [](auto& queue, auto push) {
+        constexpr int producers = 4, consumers = 4, perProducer = 50'000;
+        std::atomic<int> consumed{0};
+        std::vector<std::vector<int>> received(consumers);
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p] {
+                for (int i = 0; i < perProducer; ++i) push(queue, p * perProducer + i);
+            });
+        }
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&, c] {
+                while (consumed.load() < producers * perProducer) {
+                    if (auto value = queue.pop_front()) {
+                        received[c].push_back(*value);
+                        ++consumed;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) thread.join();
+        assert(queue.empty() && !queue.pop_front());
+        std::vector<int> all;
+        for (auto& values : received) {
+            std::vector<int> last(producers, -1);
+            for (int value : values) { // FIFO: значения производителя приходят по возрастанию
+                assert(value > last[value / perProducer]);
+                last[value / perProducer] = value;
+            }
+            all.insert(all.end(), values.begin(), values.end());
+        }
+        std::sort(all.begin(), all.end());
+        for (int i = 0; i < producers * perProducer; ++i) assert(all[i] == i);
+    };
+    {
+        ConcurrentQueue<int> queue;
+        assert(queue.empty() && !queue.pop_front());
+        queue.push_back(1);
+        queue.push_back(2);
+        assert(!queue.empty() && queue.pop_front() == 1 && queue.pop_front() == 2 && queue.empty());
+        testConcurrent(queue, [](auto& q, int value) { q.push_back(value); });
+    }
+    {
+        BoundedQueue<int> queue(4);
+        assert(queue.capacity() == 4 && queue.empty());
+        for (int i = 0; i < 4; ++i) assert(queue.push_back(i));
+        assert(!queue.push_back(4)); // Очередь заполнена
+        assert(queue.pop_front() == 0 && queue.push_back(4));
+        for (int i = 1; i <= 4; ++i) assert(queue.pop_front() == i);
+        assert(queue.empty() && !queue.pop_front());
+        BoundedQueue<int> shared(256);
+        testConcurrent(shared, [](auto& q, int value) { while (!q.push_back(value)) std::this_thread::yield(); });
+    }
+    std::cout << "ConcurrentQueue and BoundedQueue tests passed" << std::endl;
+
+    // Размер бенчмарка из аргументов командной строки (по умолчанию 1e7)
+    std::size_t size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    benchmark(size);
+    benchmarkStorage(size);
+    benchmarkMerge(size, 64);
+    // Число элементов и максимум потоков для конкурентных очередей (по умолчанию 1e6 и 64)
+    std::size_t items = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1'000'000;
+    std::size_t maxThreads = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 64;
+    benchmarkConcurrent(items, maxThreads);
+    // Максимальный размер бенчмарка сортировки (по умолчанию 1e7; 1e8 требует ~4 ГБ памяти)
+    std::size_t sortSize = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 10'000'000;
+    benchmarkSort(sortSize);
+
     return 0; // Успешное завершение программы
 }
\ No newline at end of file
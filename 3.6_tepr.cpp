@@ -4,6 +4,24 @@
 #include <cmath>      // Для математических функций (std::sqrt, std::abs)
 #include <cassert>    // Для макроса assert (проверка условий)
 #include <vector>     // Для контейнера std::vector
+#include <algorithm>  // Для std::min, std::max, std::shuffle
+#include <chrono>     // Для измерения времени в бенчмарке
+#include <cstddef>    // Для std::size_t
+#include <cstdlib>    // Для std::strtoull (разбор аргументов командной строки)
+#include <random>     // Для генерации случайных фигур
+#include <memory>     // Для std::unique_ptr (блоки арены, владеющие указатели пула)
+#include <cstdint>    // Для std::uintptr_t (выравнивание в арене)
+#include <optional>   // Для std::optional (освобождение арены в бенчмарке)
+#include <new>        // Для размещающего new
+#include <type_traits> // Для std::is_trivially_destructible_v
+#include <utility>    // Для std::forward, std::exchange
+#include <atomic>     // Для std::atomic (раздача блоков потокам)
+#include <limits>     // Для std::numeric_limits (начальные значения min/max)
+#include <span>       // Для std::span (представление коллекции фигур)
+#include <thread>     // Для std::thread (параллельные запросы)
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h> // Для SIMD-интринсиков (AVX2 / AVX-512)
+#endif
 
 // Абстрактный базовый класс для всех фигур
 class Shape {
@@ -31,13 +49,16 @@ public:
 
     // Метод вычисления площади треугольника по формуле Герона
     double area() const override final {  // override final - переопределение, запрет дальнейшего переопределения
-        // Вычисляем полупериметр
-        double semiPerimeter = perimeter() / 2.0;
-        // Вычисляем произведение по формуле Герона: p(p-a)(p-b)(p-c)
-        double product = semiPerimeter * (semiPerimeter - side1) * 
-                        (semiPerimeter - side2) * (semiPerimeter - side3);
-        // Возвращаем квадратный корень из произведения - площадь треугольника
-        return std::sqrt(product);
+        // Устойчивая форма формулы Герона (Кахан): стороны упорядочиваются a >= b >= c,
+        // скобки расставлены так, чтобы не вычитать близкие большие числа.
+        // Для тонких "игольчатых" треугольников p - a в обычной форме теряет все значащие цифры
+        double low = std::min(side1, side2), high = std::max(side1, side2);
+        double a = std::max(high, side3), middle = std::min(high, side3);
+        double b = std::max(low, middle), c = std::min(low, middle);
+        // Произведение 16 * p(p-a)(p-b)(p-c) в устойчивой расстановке скобок
+        double product = (a + (b + c)) * (c - (a - b)) * (c + (a - b)) * (a + (b - c));
+        // Площадь треугольника = sqrt(product) / 4
+        return 0.25 * std::sqrt(product);
     }
 
     // Метод вычисления периметра треугольника
@@ -93,8 +114,615 @@ public:
     }
 };
 
+// Суммарные площадь и периметр набора фигур
+struct ShapeTotals {
+    double area = 0.0;
+    double perimeter = 0.0;
+};
+
+// Пакетные ядра: один проход по массивам сторон дает и площадь, и периметр.
+// AVX-512 - 8 чисел double за инструкцию, AVX2 - 4; хвост и сборка без SIMD - скалярно
+
+// Треугольники: площадь по устойчивой формуле Герона (как в Triangle::area()), периметр - сумма сторон
+// Стороны упорядочиваются сетью min/max: a >= b >= c в каждой дорожке без ветвлений
+ShapeTotals triangleTotals(const double* side1, const double* side2, const double* side3, std::size_t count) {
+    ShapeTotals totals;
+    std::size_t index = 0;
+#if defined(__AVX512F__)
+    __m512d area = _mm512_setzero_pd(), perimeter = _mm512_setzero_pd();
+    const __m512d quarter = _mm512_set1_pd(0.25);
+    for (; index + 8 <= count; index += 8) {
+        __m512d x = _mm512_loadu_pd(side1 + index);
+        __m512d y = _mm512_loadu_pd(side2 + index);
+        __m512d z = _mm512_loadu_pd(side3 + index);
+        __m512d low = _mm512_min_pd(x, y), high = _mm512_max_pd(x, y);
+        __m512d a = _mm512_max_pd(high, z), middle = _mm512_min_pd(high, z);
+        __m512d b = _mm512_max_pd(low, middle), c = _mm512_min_pd(low, middle);
+        __m512d aMinusB = _mm512_sub_pd(a, b);
+        __m512d product = _mm512_mul_pd(_mm512_mul_pd(_mm512_add_pd(a, _mm512_add_pd(b, c)), _mm512_sub_pd(c, aMinusB)),
+                                        _mm512_mul_pd(_mm512_add_pd(c, aMinusB), _mm512_add_pd(a, _mm512_sub_pd(b, c))));
+        area = _mm512_add_pd(area, _mm512_mul_pd(quarter, _mm512_sqrt_pd(product)));
+        perimeter = _mm512_add_pd(perimeter, _mm512_add_pd(_mm512_add_pd(x, y), z));
+    }
+    totals.area = _mm512_reduce_add_pd(area);
+    totals.perimeter = _mm512_reduce_add_pd(perimeter);
+#elif defined(__AVX2__)
+    __m256d area = _mm256_setzero_pd(), perimeter = _mm256_setzero_pd();
+    const __m256d quarter = _mm256_set1_pd(0.25);
+    for (; index + 4 <= count; index += 4) {
+        __m256d x = _mm256_loadu_pd(side1 + index);
+        __m256d y = _mm256_loadu_pd(side2 + index);
+        __m256d z = _mm256_loadu_pd(side3 + index);
+        __m256d low = _mm256_min_pd(x, y), high = _mm256_max_pd(x, y);
+        __m256d a = _mm256_max_pd(high, z), middle = _mm256_min_pd(high, z);
+        __m256d b = _mm256_max_pd(low, middle), c = _mm256_min_pd(low, middle);
+        __m256d aMinusB = _mm256_sub_pd(a, b);
+        __m256d product = _mm256_mul_pd(_mm256_mul_pd(_mm256_add_pd(a, _mm256_add_pd(b, c)), _mm256_sub_pd(c, aMinusB)),
+                                        _mm256_mul_pd(_mm256_add_pd(c, aMinusB), _mm256_add_pd(a, _mm256_sub_pd(b, c))));
+        area = _mm256_add_pd(area, _mm256_mul_pd(quarter, _mm256_sqrt_pd(product)));
+        perimeter = _mm256_add_pd(perimeter, _mm256_add_pd(_mm256_add_pd(x, y), z));
+    }
+    // Горизонтальная сумма 4 дорожек
+    alignas(32) double areaLanes[4], perimeterLanes[4];
+    _mm256_store_pd(areaLanes, area);
+    _mm256_store_pd(perimeterLanes, perimeter);
+    for (int lane = 0; lane < 4; ++lane) {
+        totals.area += areaLanes[lane];
+        totals.perimeter += perimeterLanes[lane];
+    }
+#endif
+    // Скалярный хвост - через тот же метод класса
+    for (; index < count; ++index) {
+        Triangle triangle(side1[index], side2[index], side3[index]);
+        totals.area += triangle.area();
+        totals.perimeter += triangle.perimeter();
+    }
+    return totals;
+}
+
+// Сумма значений и сумма их квадратов за один проход (для квадратов и окружностей)
+ShapeTotals sumAndSquares(const double* values, std::size_t count) {
+    ShapeTotals totals;  // area - сумма квадратов, perimeter - сумма значений
+    std::size_t index = 0;
+#if defined(__AVX512F__)
+    __m512d squares = _mm512_setzero_pd(), sums = _mm512_setzero_pd();
+    for (; index + 8 <= count; index += 8) {
+        __m512d x = _mm512_loadu_pd(values + index);
+        squares = _mm512_add_pd(squares, _mm512_mul_pd(x, x));
+        sums = _mm512_add_pd(sums, x);
+    }
+    totals.area = _mm512_reduce_add_pd(squares);
+    totals.perimeter = _mm512_reduce_add_pd(sums);
+#elif defined(__AVX2__)
+    __m256d squares = _mm256_setzero_pd(), sums = _mm256_setzero_pd();
+    for (; index + 4 <= count; index += 4) {
+        __m256d x = _mm256_loadu_pd(values + index);
+        squares = _mm256_add_pd(squares, _mm256_mul_pd(x, x));
+        sums = _mm256_add_pd(sums, x);
+    }
+    alignas(32) double squareLanes[4], sumLanes[4];
+    _mm256_store_pd(squareLanes, squares);
+    _mm256_store_pd(sumLanes, sums);
+    for (int lane = 0; lane < 4; ++lane) {
+        totals.area += squareLanes[lane];
+        totals.perimeter += sumLanes[lane];
+    }
+#endif
+    for (; index < count; ++index) {
+        totals.area += values[index] * values[index];
+        totals.perimeter += values[index];
+    }
+    return totals;
+}
+
+// Хранилище фигур, разделенное по типам: треугольники, квадраты и окружности лежат
+// каждый в своих непрерывных массивах (SoA), без указателей, new и виртуальных вызовов.
+// Площадь и периметр считаются пакетно по каждому типу
+class ShapeStore {
+private:
+    std::vector<double> m_side1, m_side2, m_side3;  // Стороны треугольников
+    std::vector<double> m_squareSides;              // Стороны квадратов
+    std::vector<double> m_radii;                    // Радиусы окружностей
+
+public:
+    // Добавление фигур каждого типа
+    void addTriangle(double first, double second, double third) {
+        m_side1.push_back(first);
+        m_side2.push_back(second);
+        m_side3.push_back(third);
+    }
+    void addSquare(double length) { m_squareSides.push_back(length); }
+    void addCircle(double radius) { m_radii.push_back(radius); }
+
+    // Число фигур каждого типа и общее
+    std::size_t triangles() const { return m_side1.size(); }
+    std::size_t squares() const { return m_squareSides.size(); }
+    std::size_t circles() const { return m_radii.size(); }
+    std::size_t size() const { return triangles() + squares() + circles(); }
+
+    // Суммарные площадь и периметр всех фигур за один проход по каждому массиву
+    ShapeTotals totals() const {
+        ShapeTotals result = triangleTotals(m_side1.data(), m_side2.data(), m_side3.data(), triangles());
+        // Квадраты: площадь = сумма s^2, периметр = 4 * сумма s
+        ShapeTotals squareSums = sumAndSquares(m_squareSides.data(), squares());
+        result.area += squareSums.area;
+        result.perimeter += 4.0 * squareSums.perimeter;
+        // Окружности: площадь = pi * сумма r^2, длина = 2 * pi * сумма r
+        ShapeTotals circleSums = sumAndSquares(m_radii.data(), circles());
+        result.area += std::numbers::pi * circleSums.area;
+        result.perimeter += 2.0 * std::numbers::pi * circleSums.perimeter;
+        return result;
+    }
+};
+
+// Бенчмарк: std::vector<Shape*> с виртуальными вызовами (в порядке создания и перемешанный)
+// против ShapeStore с пакетными ядрами; суммарные площадь и периметр count фигур
+void benchmark(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::uniform_int_distribution<int> kind(0, 2);
+    std::uniform_real_distribution<double> length(1.0, 10.0);
+
+    std::vector<Shape*> shapes;
+    shapes.reserve(count);
+    ShapeStore store;
+    for (std::size_t i = 0; i < count; ++i) {
+        switch (kind(random_generator)) {
+        case 0: {
+            // Треугольник с гарантированно выполненным неравенством треугольника
+            double a = length(random_generator), b = length(random_generator);
+            double c = std::abs(a - b) + (a + b - std::abs(a - b)) * 0.5;
+            shapes.push_back(new Triangle(a, b, c));
+            store.addTriangle(a, b, c);
+            break;
+        }
+        case 1: {
+            double side = length(random_generator);
+            shapes.push_back(new Square(side));
+            store.addSquare(side);
+            break;
+        }
+        default: {
+            double radius = length(random_generator);
+            shapes.push_back(new Circle(radius));
+            store.addCircle(radius);
+            break;
+        }
+        }
+    }
+
+    // Измеряет время одного вызова в миллисекундах
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    // Суммирование через виртуальные вызовы
+    auto virtualTotals = [](const std::vector<Shape*>& list) {
+        ShapeTotals totals;
+        for (const Shape* shape : list) {
+            totals.area += shape->area();
+            totals.perimeter += shape->perimeter();
+        }
+        return totals;
+    };
+
+    ShapeTotals ordered, shuffled, batched;
+    double orderedTime = measure([&] { ordered = virtualTotals(shapes); });
+    std::vector<Shape*> mixed = shapes;
+    std::shuffle(mixed.begin(), mixed.end(), random_generator);
+    double shuffledTime = measure([&] { shuffled = virtualTotals(mixed); });
+    double storeTime = measure([&] { batched = store.totals(); });
+
+    // Результаты совпадают с точностью до порядка суммирования
+    assert(std::abs(ordered.area - batched.area) <= 1e-9 * ordered.area);
+    assert(std::abs(shuffled.perimeter - batched.perimeter) <= 1e-9 * shuffled.perimeter);
+
+    std::cout << count << " shapes (total area + perimeter): virtual " << orderedTime
+              << " ms, virtual shuffled " << shuffledTime
+              << " ms, ShapeStore " << storeTime << " ms" << std::endl;
+
+    for (Shape* shape : shapes) delete shape;
+}
+
+// Монотонная арена: память выделяется большими блоками и раздается сдвигом указателя,
+// отдельные объекты не освобождаются - вся арена освобождается за один раз.
+// Деструкторы нетривиальных объектов (у Shape виртуальный деструктор) запоминаются
+// и вызываются при освобождении арены
+class Arena {
+private:
+    // Запись для вызова деструктора объекта при освобождении арены
+    struct Destructor {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    std::size_t m_blockSize;                          // Размер очередного блока
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks; // Выделенные блоки
+    std::byte* m_current = nullptr;                   // Свободное место в текущем блоке
+    std::size_t m_left = 0;                           // Сколько байтов осталось в текущем блоке
+    std::vector<Destructor> m_destructors;            // Объекты, которым нужен деструктор
+
+public:
+    explicit Arena(std::size_t blockSize = 1 << 20) : m_blockSize(blockSize) {}
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    ~Arena() { release(); }
+
+    // Выделение bytes байтов с выравниванием alignment
+    void* allocate(std::size_t bytes, std::size_t alignment) {
+        std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(m_current) % alignment) % alignment;
+        if (m_current == nullptr || padding + bytes > m_left) {
+            // Новый блок; запрос больше блока получает блок своего размера
+            std::size_t size = std::max(m_blockSize, bytes + alignment);
+            m_blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+            m_current = m_blocks.back().get();
+            m_left = size;
+            padding = (alignment - reinterpret_cast<std::uintptr_t>(m_current) % alignment) % alignment;
+        }
+        void* result = m_current + padding;
+        m_current += padding + bytes;
+        m_left -= padding + bytes;
+        return result;
+    }
+
+    // Создание объекта T в арене
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        T* object = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            m_destructors.push_back({object, [](void* pointer) { static_cast<T*>(pointer)->~T(); }});
+        }
+        return object;
+    }
+
+    // Освобождение всей арены: деструкторы в обратном порядке, затем все блоки разом
+    void release() {
+        for (auto it = m_destructors.rbegin(); it != m_destructors.rend(); ++it) it->destroy(it->object);
+        m_destructors.clear();
+        m_blocks.clear();
+        m_current = nullptr;
+        m_left = 0;
+    }
+};
+
+// Владеющая коллекция фигур в арене: фигуры создаются в арене, коллекция хранит
+// указатели на базовый класс для обхода, а при уничтожении освобождает всю арену сразу.
+// Деструкторы вызываются через виртуальный ~Shape() по тем же указателям,
+// поэтому отдельный список деструкторов в арене не ведется
+class ArenaShapes {
+private:
+    std::unique_ptr<Arena> m_arena = std::make_unique<Arena>();  // unique_ptr - коллекцию можно перемещать
+    std::vector<Shape*> m_shapes;
+
+public:
+    ArenaShapes() = default;
+    // После перемещения источник пуст; add() создаст для него новую арену
+    ArenaShapes(ArenaShapes&& other) noexcept
+        : m_arena(std::move(other.m_arena)), m_shapes(std::exchange(other.m_shapes, {})) {}
+    ArenaShapes& operator=(ArenaShapes&& other) noexcept {
+        if (this != &other) {
+            destroyShapes();  // Деструкторы текущих фигур - до освобождения их арены
+            m_arena = std::move(other.m_arena);
+            m_shapes = std::exchange(other.m_shapes, {});
+        }
+        return *this;
+    }
+    ~ArenaShapes() {
+        destroyShapes();
+        // Память всех фигур освобождает деструктор арены
+    }
+
+    // Резервирование места под указатели
+    void reserve(std::size_t count) { m_shapes.reserve(count); }
+
+    // Добавление фигуры типа T
+    template <typename T, typename... Args>
+    T* add(Args&&... args) {
+        if (!m_arena) m_arena = std::make_unique<Arena>();  // Коллекция, из которой переместили
+        T* shape = new (m_arena->allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        m_shapes.push_back(shape);
+        return shape;
+    }
+
+    // Обход как у std::vector<Shape*>
+    std::size_t size() const { return m_shapes.size(); }
+    Shape* operator[](std::size_t index) const { return m_shapes[index]; }
+    auto begin() const { return m_shapes.begin(); }
+    auto end() const { return m_shapes.end(); }
+    // Представление для запросов (ShapeQuery)
+    std::span<Shape* const> shapes() const { return m_shapes; }
+
+private:
+    void destroyShapes() {
+        for (Shape* shape : m_shapes) shape->~Shape();
+        m_shapes.clear();
+    }
+};
+
+// Пул объектов одного типа: слоты фиксированного размера выделяются пачками,
+// освобожденные слоты попадают в список свободных и переиспользуются без обращения к malloc
+template <typename T>
+class ObjectPool {
+private:
+    // Слот хранит либо объект, либо указатель на следующий свободный слот
+    union Slot {
+        Slot* next;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::size_t m_chunkSize;                            // Число слотов в пачке
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;      // Выделенные пачки
+    Slot* m_free = nullptr;                             // Список свободных слотов
+
+public:
+    explicit ObjectPool(std::size_t chunkSize = 4096) : m_chunkSize(chunkSize) {}
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    // Деструктор: объектов, созданных в пуле, к этому моменту быть не должно
+    // (владеющие указатели пула должны быть уничтожены раньше самого пула)
+
+    // Создание объекта в свободном слоте
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (m_free == nullptr) {
+            // Новая пачка: все ее слоты связываются в список свободных
+            m_chunks.push_back(std::make_unique_for_overwrite<Slot[]>(m_chunkSize));
+            Slot* chunk = m_chunks.back().get();
+            for (std::size_t i = 0; i < m_chunkSize; ++i) chunk[i].next = i + 1 < m_chunkSize ? &chunk[i + 1] : nullptr;
+            m_free = chunk;
+        }
+        Slot* slot = std::exchange(m_free, m_free->next);
+        return new (slot->storage) T(std::forward<Args>(args)...);
+    }
+
+    // Уничтожение объекта и возврат слота в список свободных
+    void destroy(T* object) {
+        object->~T();
+        Slot* slot = reinterpret_cast<Slot*>(object);
+        slot->next = m_free;
+        m_free = slot;
+    }
+};
+
+// Удалитель для std::unique_ptr: возвращает объект в его пул
+template <typename T>
+struct PoolDeleter {
+    ObjectPool<T>* pool;
+    void operator()(T* object) const { pool->destroy(object); }
+};
+
+// Владеющий указатель на объект из пула
+template <typename T>
+using PoolPtr = std::unique_ptr<T, PoolDeleter<T>>;
+
+// Создание объекта в пуле с владеющим указателем
+template <typename T, typename... Args>
+PoolPtr<T> makePooled(ObjectPool<T>& pool, Args&&... args) {
+    return PoolPtr<T>(pool.create(std::forward<Args>(args)...), PoolDeleter<T>{&pool});
+}
+
+// Бенчмарк выделения памяти: new/delete против арены и пулов
+// Три фазы: создание count фигур, обход (сумма площадей), освобождение
+void benchmarkAllocation(std::size_t count) {
+    // Измеряет время одного вызова в миллисекундах
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    double checksum = 0.0;
+    auto traverse = [&](const auto& shapes) {
+        for (const Shape* shape : shapes) checksum += shape->area();
+    };
+
+    // new / delete для каждой фигуры
+    std::vector<Shape*> heap;
+    heap.reserve(count);
+    double heapCreate = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            switch (i % 3) {
+            case 0: heap.push_back(new Triangle(3.0, 4.0, 5.0)); break;
+            case 1: heap.push_back(new Square(1.0 + i % 7)); break;
+            default: heap.push_back(new Circle(1.0 + i % 5)); break;
+            }
+        }
+    });
+    double heapTraverse = measure([&] { traverse(heap); });
+    double heapFree = measure([&] { for (Shape* shape : heap) delete shape; });
+
+    // Арена: освобождение одним вызовом деструктора коллекции
+    std::optional<ArenaShapes> arena(std::in_place);
+    arena->reserve(count);
+    double arenaCreate = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            switch (i % 3) {
+            case 0: arena->add<Triangle>(3.0, 4.0, 5.0); break;
+            case 1: arena->add<Square>(1.0 + i % 7); break;
+            default: arena->add<Circle>(1.0 + i % 5); break;
+            }
+        }
+    });
+    double arenaTraverse = measure([&] { traverse(*arena); });
+    double arenaFree = measure([&] { arena.reset(); });
+
+    // Пулы по типам с владеющими указателями
+    ObjectPool<Triangle> triangles;
+    ObjectPool<Square> squares;
+    ObjectPool<Circle> circles;
+    std::vector<PoolPtr<Triangle>> pooledTriangles;
+    std::vector<PoolPtr<Square>> pooledSquares;
+    std::vector<PoolPtr<Circle>> pooledCircles;
+    std::vector<Shape*> pooled;
+    pooled.reserve(count);
+    pooledTriangles.reserve(count / 3 + 1);
+    pooledSquares.reserve(count / 3 + 1);
+    pooledCircles.reserve(count / 3 + 1);
+    double poolCreate = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            switch (i % 3) {
+            case 0: pooledTriangles.push_back(makePooled(triangles, 3.0, 4.0, 5.0)); pooled.push_back(pooledTriangles.back().get()); break;
+            case 1: pooledSquares.push_back(makePooled(squares, 1.0 + i % 7)); pooled.push_back(pooledSquares.back().get()); break;
+            default: pooledCircles.push_back(makePooled(circles, 1.0 + i % 5)); pooled.push_back(pooledCircles.back().get()); break;
+            }
+        }
+    });
+    double poolTraverse = measure([&] { traverse(pooled); });
+    double poolFree = measure([&] {
+        pooledTriangles.clear();
+        pooledSquares.clear();
+        pooledCircles.clear();
+    });
+
+    std::cout << count << " shapes (create / traverse / free, ms): new-delete " << heapCreate << " / " << heapTraverse << " / " << heapFree
+              << "; arena " << arenaCreate << " / " << arenaTraverse << " / " << arenaFree
+              << "; pool " << poolCreate << " / " << poolTraverse << " / " << poolFree
+              << " [checksum " << checksum << "]" << std::endl;
+}
+
+// Параллельные агрегирующие запросы над коллекцией фигур (std::vector<Shape*>, ArenaShapes)
+// Коллекция делится на блоки фиксированного размера, потоки разбирают блоки по очереди,
+// частичные результаты блоков объединяются в порядке блоков. Разбиение не зависит
+// от числа потоков, поэтому суммы с плавающей точкой детерминированы
+class ShapeQuery {
+public:
+    // Сводка по коллекции
+    struct Summary {
+        std::size_t count = 0;
+        double totalArea = 0.0;
+        double meanArea = 0.0;
+        double minPerimeter = std::numeric_limits<double>::infinity();
+        double maxPerimeter = -std::numeric_limits<double>::infinity();
+    };
+
+    // Размер блока - единица работы потока и единица детерминированной суммы
+    static constexpr std::size_t blockSize = 1 << 14;
+
+    explicit ShapeQuery(std::span<Shape* const> shapes, unsigned threads = std::thread::hardware_concurrency())
+        : m_shapes(shapes), m_threads(std::max(1u, threads)) {}
+
+    // Суммарная и средняя площадь, минимальный и максимальный периметр за один проход
+    Summary summary() const {
+        auto partial = forEachBlock<Summary>([&](std::size_t begin, std::size_t end, Summary& block) {
+            for (std::size_t i = begin; i < end; ++i) {
+                double perimeter = m_shapes[i]->perimeter();
+                block.totalArea += m_shapes[i]->area();
+                block.minPerimeter = std::min(block.minPerimeter, perimeter);
+                block.maxPerimeter = std::max(block.maxPerimeter, perimeter);
+            }
+            block.count = end - begin;
+        });
+        Summary result;
+        for (const auto& block : partial) {
+            result.count += block.count;
+            result.totalArea += block.totalArea;
+            result.minPerimeter = std::min(result.minPerimeter, block.minPerimeter);
+            result.maxPerimeter = std::max(result.maxPerimeter, block.maxPerimeter);
+        }
+        result.meanArea = result.count > 0 ? result.totalArea / result.count : 0.0;
+        return result;
+    }
+
+    // Гистограмма площадей: bins равных корзин на [low, high);
+    // площади вне диапазона попадают в крайние корзины, NaN - в первую корзину
+    std::vector<std::size_t> areaHistogram(double low, double high, std::size_t bins) const {
+        assert(bins > 0 && high > low);
+        auto partial = forEachBlock<std::vector<std::size_t>>([&](std::size_t begin, std::size_t end, std::vector<std::size_t>& block) {
+            block.assign(bins, 0);
+            double scale = bins / (high - low);
+            for (std::size_t i = begin; i < end; ++i) {
+                double position = (m_shapes[i]->area() - low) * scale;
+                // !(position > 0) ловит и NaN; приведение только для значений в [0, bins)
+                std::size_t bin = !(position > 0.0) ? 0 : position >= bins ? bins - 1 : static_cast<std::size_t>(position);
+                ++block[bin];
+            }
+        });
+        std::vector<std::size_t> result(bins, 0);
+        for (const auto& block : partial) {
+            for (std::size_t bin = 0; bin < bins; ++bin) result[bin] += block[bin];
+        }
+        return result;
+    }
+
+    // Число фигур, удовлетворяющих условию predicate(const Shape&)
+    template <typename Predicate>
+    std::size_t count(Predicate predicate) const {
+        auto partial = forEachBlock<std::size_t>([&](std::size_t begin, std::size_t end, std::size_t& block) {
+            block = 0;
+            for (std::size_t i = begin; i < end; ++i) block += predicate(*m_shapes[i]) ? 1 : 0;
+        });
+        std::size_t result = 0;
+        for (std::size_t block : partial) result += block;
+        return result;
+    }
+
+private:
+    // Вычисление function(begin, end, результат блока) для всех блоков в m_threads потоках
+    template <typename Partial, typename Function>
+    std::vector<Partial> forEachBlock(Function function) const {
+        std::size_t blocks = (m_shapes.size() + blockSize - 1) / blockSize;
+        std::vector<Partial> partial(blocks);
+        std::atomic<std::size_t> next{0};
+        auto worker = [&] {
+            for (std::size_t block = next++; block < blocks; block = next++) {
+                std::size_t begin = block * blockSize;
+                function(begin, std::min(m_shapes.size(), begin + blockSize), partial[block]);
+            }
+        };
+        // Текущий поток тоже работает; дополнительные потоки - только если блоков больше одного
+        std::vector<std::thread> workers;
+        for (unsigned t = 1; t < std::min<std::size_t>(m_threads, blocks); ++t) workers.emplace_back(worker);
+        worker();
+        for (auto& thread : workers) thread.join();
+        return partial;
+    }
+
+    std::span<Shape* const> m_shapes;  // Коллекция (не владеет фигурами)
+    unsigned m_threads;                // Число потоков
+};
+
+// Бенчмарк масштабирования запросов: сводка + гистограмма + фильтр на 1, 2, 4, ... потоках
+void benchmarkQuery(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::uniform_real_distribution<double> length(1.0, 10.0);
+    ArenaShapes shapes;
+    shapes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        double a = length(random_generator);
+        switch (i % 3) {
+        case 0: shapes.add<Triangle>(a, a, a); break;
+        case 1: shapes.add<Square>(a); break;
+        default: shapes.add<Circle>(a); break;
+        }
+    }
+
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    double reference = 0.0;
+    std::cout << count << " shapes, summary + histogram + count (ms):";
+    // 1, 2, 4, ... и последним шагом - все потоки
+    std::vector<unsigned> threadCounts;
+    for (unsigned threads = 1; threads < maxThreads; threads *= 2) threadCounts.push_back(threads);
+    threadCounts.push_back(maxThreads);
+    for (unsigned threads : threadCounts) {
+        ShapeQuery query(shapes.shapes(), threads);
+        auto begin = std::chrono::steady_clock::now();
+        auto summary = query.summary();
+        auto histogram = query.areaHistogram(0.0, 320.0, 64);
+        auto large = query.count([](const Shape& shape) { return shape.area() > 100.0; });
+        auto end = std::chrono::steady_clock::now();
+        // Сумма не зависит от числа потоков бит в бит
+        if (threads == 1) reference = summary.totalArea;
+        assert(summary.totalArea == reference);
+        std::cout << " " << threads << " threads " << std::chrono::duration<double, std::milli>(end - begin).count()
+                  << " [" << histogram[0] + large << "]";
+    }
+    std::cout << std::endl;
+}
+
 // Главная функция программы
-int main() {
+int main(int argc, char** argv) {
     // Тестирование класса Triangle
     // Создаем треугольник со сторонами 3, 4, 5 (египетский треугольник)
     Triangle triangle(3.0, 4.0, 5.0);
@@ -149,8 +777,152 @@ int main() {
     }
     shapes.clear();  // Очищаем вектор (удаляем все указатели)
     
+    // Тестирование ShapeStore: те же фигуры дают те же суммы, что и виртуальные вызовы
+    ShapeStore store;
+    store.addTriangle(3.0, 4.0, 5.0);
+    store.addSquare(5.0);
+    store.addCircle(3.0);
+    ShapeTotals storeTotals = store.totals();
+    assert(store.size() == 3);
+    assert(std::abs(storeTotals.area - (6.0 + 25.0 + 28.2743)) <= 1e-3);
+    assert(std::abs(storeTotals.perimeter - (12.0 + 20.0 + 18.8496)) <= 1e-3);
+    // Больше фигур, чем ширина SIMD-регистра, плюс скалярный хвост
+    ShapeStore many;
+    double expectedArea = 0.0, expectedPerimeter = 0.0;
+    for (int i = 1; i <= 37; ++i) {
+        Triangle t(i, i + 1.0, i + 1.5);
+        Square sq(i * 0.5);
+        Circle c(i * 0.25);
+        many.addTriangle(i, i + 1.0, i + 1.5);
+        many.addSquare(i * 0.5);
+        many.addCircle(i * 0.25);
+        expectedArea += t.area() + sq.area() + c.area();
+        expectedPerimeter += t.perimeter() + sq.perimeter() + c.perimeter();
+    }
+    ShapeTotals manyTotals = many.totals();
+    assert(std::abs(manyTotals.area - expectedArea) <= 1e-9 * expectedArea);
+    assert(std::abs(manyTotals.perimeter - expectedPerimeter) <= 1e-9 * expectedPerimeter);
+    std::cout << "ShapeStore test passed" << std::endl;
+
+    // Тестирование арены: фигуры создаются в арене и освобождаются вместе с коллекцией
+    {
+        ArenaShapes arenaShapes;
+        arenaShapes.add<Triangle>(3.0, 4.0, 5.0);
+        arenaShapes.add<Square>(5.0);
+        arenaShapes.add<Circle>(3.0);
+        assert(arenaShapes.size() == 3);
+        assert(arenaShapes[0]->area() == 6.0 && arenaShapes[1]->perimeter() == 20.0);
+        // Много объектов - несколько блоков арены; выравнивание соблюдается
+        Arena arena(64);
+        for (int i = 0; i < 100; ++i) {
+            Circle* circle = arena.create<Circle>(i);
+            assert(reinterpret_cast<std::uintptr_t>(circle) % alignof(Circle) == 0);
+            assert(circle->perimeter() == 2.0 * std::numbers::pi * i);
+        }
+    }  // Здесь арены освобождаются целиком
+    {
+        // Перемещающее присваивание вызывает деструкторы прежних фигур цели,
+        // а коллекция, из которой переместили, снова пригодна для add()
+        struct CountedSquare : Shape {  // Квадрат, считающий вызовы деструктора
+            double side;
+            int* destroyed;
+            CountedSquare(double length, int* counter) : side(length), destroyed(counter) {}
+            ~CountedSquare() override { ++*destroyed; }
+            double perimeter() const override { return 4 * side; }
+            double area() const override { return side * side; }
+        };
+        int destroyed = 0;
+        ArenaShapes target, source;
+        target.add<CountedSquare>(1.0, &destroyed);
+        target.add<CountedSquare>(2.0, &destroyed);
+        source.add<CountedSquare>(3.0, &destroyed);
+        target = std::move(source);
+        assert(destroyed == 2 && target.size() == 1 && target[0]->area() == 9.0);
+        ArenaShapes moved(std::move(target));
+        assert(moved.size() == 1 && target.size() == 0);
+        target.add<CountedSquare>(4.0, &destroyed);
+        assert(target.size() == 1 && target[0]->area() == 16.0);
+        source.add<Circle>(1.0);
+        target = ArenaShapes();
+        assert(destroyed == 3);
+    }
+
+    // Тестирование пула: освобожденный слот переиспользуется
+    {
+        ObjectPool<Square> pool(2);
+        Square* first = pool.create(1.0);
+        Square* second = pool.create(2.0);
+        Square* third = pool.create(3.0);  // Вторая пачка
+        assert(first->area() == 1.0 && second->area() == 4.0 && third->area() == 9.0);
+        pool.destroy(second);
+        Square* reused = pool.create(4.0);
+        assert(reused == second && reused->area() == 16.0);
+        pool.destroy(first);
+        pool.destroy(third);
+        pool.destroy(reused);
+        PoolPtr<Square> owned = makePooled(pool, 6.0);
+        assert(owned->perimeter() == 24.0);
+    }
+    std::cout << "Arena and pool tests passed" << std::endl;
+
+    // Устойчивая формула Герона: тонкий равнобедренный треугольник 1, 1, 1e-8
+    // Точная площадь c / 4 * sqrt(4a^2 - c^2); обычная форма теряет около половины значащих цифр
+    Triangle needle(1.0, 1.0, 1e-8);
+    double needleArea = 1e-8 / 4.0 * std::sqrt(4.0 - 1e-16);
+    assert(std::abs(needle.area() - needleArea) <= 1e-14 * needleArea);
+    ShapeStore needles;
+    for (int i = 0; i < 9; ++i) needles.addTriangle(1.0, 1e-8, 1.0);
+    assert(std::abs(needles.totals().area - 9 * needleArea) <= 1e-13 * needleArea);
+
+    // Тестирование ShapeQuery: сводка, гистограмма и фильтр, одинаковые на разном числе потоков
+    {
+        ArenaShapes collection;
+        for (int i = 1; i <= 50'000; ++i) {
+            if (i % 2 == 0) collection.add<Square>(i % 10 + 1.0);
+            else collection.add<Circle>(i % 7 + 1.0);
+        }
+        ShapeQuery single(collection.shapes(), 1), parallel(collection.shapes(), 4);
+        auto first = single.summary();
+        auto second = parallel.summary();
+        assert(first.count == 50'000 && second.count == 50'000);
+        assert(first.totalArea == second.totalArea);  // Детерминированная сумма
+        assert(first.minPerimeter == 4.0 && first.maxPerimeter == 2.0 * std::numbers::pi * 7.0);
+        double expectedTotal = 0.0;
+        for (Shape* shape : collection) expectedTotal += shape->area();
+        assert(std::abs(first.totalArea - expectedTotal) <= 1e-9 * expectedTotal);
+        assert(std::abs(first.meanArea - expectedTotal / 50'000) <= 1e-9 * expectedTotal);
+
+        auto histogram = parallel.areaHistogram(0.0, 100.0, 10);
+        std::size_t histogramTotal = 0;
+        for (std::size_t bin : histogram) histogramTotal += bin;
+        assert(histogramTotal == 50'000);
+        assert(histogram == single.areaHistogram(0.0, 100.0, 10));
+        // Квадраты со стороной 1, 2, 3 (площади 1, 4, 9) и окружность радиуса 1 (площадь pi) - в первой корзине
+        assert(histogram[0] == parallel.count([](const Shape& shape) { return shape.area() < 10.0; }));
+        assert(parallel.count([](const Shape& shape) { return shape.perimeter() > 1000.0; }) == 0);
+        std::vector<Shape*> empty;
+        assert(ShapeQuery(empty).summary().count == 0);
+        // Бесконечная площадь - в последнюю корзину, NaN - в первую
+        struct FixedArea : Shape {
+            double value;
+            explicit FixedArea(double area) : value(area) {}
+            double perimeter() const override { return 0.0; }
+            double area() const override { return value; }
+        };
+        FixedArea infinite(std::numeric_limits<double>::infinity()), undefined(std::numeric_limits<double>::quiet_NaN());
+        std::vector<Shape*> special = {&infinite, &undefined};
+        assert((ShapeQuery(special, 2).areaHistogram(0.0, 1.0, 4) == std::vector<std::size_t>{1, 0, 0, 1}));
+    }
+    std::cout << "ShapeQuery tests passed" << std::endl;
+
     // Финальное сообщение об успешном выполнении всех тестов
     std::cout << "All tests are passed successfully" << std::endl;
+
+    // Бенчмарк: число фигур задается аргументом командной строки (по умолчанию 1e6)
+    std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1'000'000;
+    benchmark(count);
+    benchmarkAllocation(count);
+    benchmarkQuery(count);
     
     // Возвращаем 0 - признак успешного завершения программы
     return 0;
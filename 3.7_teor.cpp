@@ -1,47 +1,274 @@
 // Подключение необходимых библиотек
 #include <algorithm>   // Для алгоритмов (std::copy, std::swap, std::ranges::copy)
+#include <atomic>      // Для std::atomic (ConcurrentVector)
+#include <bit>         // Для std::bit_width (номер сегмента)
+#include <mutex>       // Для std::mutex (сравнение в бенчмарке)
+#include <thread>      // Для std::thread (параллельное дополнение)
 #include <cstddef>     // Для типа std::size_t (беззнаковый тип для размеров)
 #include <iostream>    // Для ввода-вывода (std::cout, std::endl)
-#include <memory>      // Для умных указателей (не используется напрямую)
+#include <memory>      // Для std::allocator, std::allocator_traits, std::uninitialized_move, std::destroy
 #include <utility>     // Для std::exchange (перемещение с обнулением)
 #include <cassert>     // Для макроса assert (проверка условий)
 #include <cmath>       // Для математических функций (std::pow)
+#include <chrono>      // Для измерения времени в бенчмарке
+#include <cstdlib>     // Для std::malloc, std::realloc, std::free, std::strtoull
+#include <cstring>     // Для std::memcpy (перенос тривиально перемещаемых типов)
+#include <cstdint>     // Для std::uint32_t, std::uint64_t
+#include <initializer_list> // Для std::initializer_list
+#include <new>         // Для std::bad_alloc, размещающего new
+#include <random>      // Для случайных размеров в бенчмарке
+#include <string>      // Для std::string (тесты и бенчмарк)
+#include <type_traits> // Для свойств типов (std::is_trivially_copyable_v и др.)
+#include <vector>      // Для std::vector (сравнение в бенчмарке)
+#include <fstream>     // Для чтения /proc/self/status, сравнения с потоковым вводом-выводом
+#include <filesystem>  // Для временных файлов в тестах и бенчмарке
+#include <stdexcept>   // Для std::runtime_error, std::logic_error
+#include <system_error> // Для std::system_error (ошибки системных вызовов)
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h> // Для SIMD-интринсиков (AVX2 / AVX-512)
+#endif
+#if defined(__linux__)
+#include <fcntl.h>     // Для open
+#include <sys/mman.h>  // Для mmap, mremap, munmap, madvise, msync
+#include <sys/stat.h>  // Для fstat
+#include <unistd.h>    // Для sysconf (размер страницы), ftruncate, fsync, close
+#endif
+
+// Признак тривиальной перемещаемости: объект можно перенести в другую память побайтовым копированием,
+// не вызывая конструктор перемещения и деструктор. По умолчанию - тривиально копируемые типы;
+// для других типов, для которых это верно, признак можно специализировать
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+// Распределитель на malloc/free с операцией reallocate (std::realloc)
+// realloc часто расширяет блок на месте или переносит страницы без копирования,
+// поэтому Vector использует его для тривиально перемещаемых типов
+template <typename T>
+struct MallocAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "malloc does not guarantee stronger alignment");
+    using value_type = T;
+
+    MallocAllocator() = default;
+    template <typename U>
+    MallocAllocator(const MallocAllocator<U>&) {}
+
+    T* allocate(std::size_t count) {
+        void* memory = std::malloc(count * sizeof(T));
+        if (memory == nullptr) throw std::bad_alloc();
+        return static_cast<T*>(memory);
+    }
+    void deallocate(T* pointer, std::size_t) { std::free(pointer); }
+
+    // Изменение размера блока с сохранением содержимого (побайтово)
+    T* reallocate(T* pointer, std::size_t, std::size_t count) {
+        void* memory = std::realloc(pointer, count * sizeof(T));
+        if (memory == nullptr) throw std::bad_alloc();
+        return static_cast<T*>(memory);
+    }
+
+    template <typename U>
+    bool operator==(const MallocAllocator<U>&) const { return true; }
+};
+
+#if defined(__linux__)
+// Распределитель на анонимных отображениях памяти (mmap) для больших буферов
+// Размер округляется до страниц; reallocate использует mremap: отображение растет на месте,
+// если за ним свободно адресное пространство, иначе страницы переносятся в новое место без копирования
+// данных. Пик памяти при росте - новый размер, а не старый + новый, как при копировании.
+// Каждое выделение - целые страницы, поэтому распределитель нужен для больших векторов
+template <typename T>
+struct MmapAllocator {
+    using value_type = T;
+
+    MmapAllocator() = default;
+    template <typename U>
+    MmapAllocator(const MmapAllocator<U>&) {}
+
+    // Размер отображения для count элементов (кратен странице)
+    static std::size_t mappingBytes(std::size_t count) {
+        static const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        std::size_t bytes = count * sizeof(T);
+        return (bytes + page - 1) / page * page;
+    }
+
+    T* allocate(std::size_t count) {
+        void* memory = mmap(nullptr, mappingBytes(count), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) throw std::bad_alloc();
+        return static_cast<T*>(memory);
+    }
+    void deallocate(T* pointer, std::size_t count) { munmap(pointer, mappingBytes(count)); }
+
+    // Рост или уменьшение отображения с сохранением содержимого (тривиально перемещаемые типы)
+    T* reallocate(T* pointer, std::size_t old_count, std::size_t count) {
+        std::size_t oldBytes = mappingBytes(old_count), newBytes = mappingBytes(count);
+        if (oldBytes == newBytes) return pointer;
+        void* memory = mremap(pointer, oldBytes, newBytes, MREMAP_MAYMOVE);
+        if (memory == MAP_FAILED) throw std::bad_alloc();
+        return static_cast<T*>(memory);
+    }
+
+    template <typename U>
+    bool operator==(const MmapAllocator<U>&) const { return true; }
+};
+#endif
+
+// Использование больших страниц (2 МБ) для буферов от hugePageThreshold байт
+enum class HugePages {
+    None,         // Обычные страницы
+    Transparent,  // Буфер выровнен на 2 МБ и помечен MADV_HUGEPAGE (THP)
+    Explicit      // mmap с MAP_HUGETLB; если зарезервированных страниц нет - обычный mmap
+};
+
+// Распределитель с выравниванием Alignment (по умолчанию 64 - кэш-линия и регистр AVX-512)
+// и, для больших буферов, большими страницами: меньше промахов TLB при проходе по гигабайтам
+template <typename T, std::size_t Alignment = 64, HugePages Pages = HugePages::None>
+struct AlignedAllocator {
+    static_assert(std::has_single_bit(Alignment) && Alignment >= alignof(T), "alignment must be a power of two");
+    using value_type = T;
+    template <typename U>
+    struct rebind {
+        using other = AlignedAllocator<U, Alignment, Pages>;
+    };
+
+    static constexpr std::size_t hugePageSize = std::size_t{2} << 20;
+    static constexpr std::size_t hugePageThreshold = hugePageSize;  // Меньшие буферы - обычные страницы
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment, Pages>&) {}
+
+    T* allocate(std::size_t count) {
+        std::size_t bytes = count * sizeof(T);
+#if defined(__linux__)
+        if (Pages != HugePages::None && bytes >= hugePageThreshold) {
+            std::size_t rounded = roundToHugePages(bytes);
+            if constexpr (Pages == HugePages::Transparent) {
+                void* memory = std::aligned_alloc(hugePageSize, rounded);
+                if (memory == nullptr) throw std::bad_alloc();
+                madvise(memory, rounded, MADV_HUGEPAGE);  // Подсказка; без THP страницы останутся обычными
+                return static_cast<T*>(memory);
+            } else {
+                void* memory = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                if (memory == MAP_FAILED) { // Нет зарезервированных больших страниц
+                    memory = mmap(nullptr, rounded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                }
+                if (memory == MAP_FAILED) throw std::bad_alloc();
+                return static_cast<T*>(memory);
+            }
+        }
+#endif
+        return static_cast<T*>(::operator new(bytes, std::align_val_t{Alignment}));
+    }
+
+    void deallocate(T* pointer, std::size_t count) {
+        std::size_t bytes = count * sizeof(T);
+#if defined(__linux__)
+        if (Pages != HugePages::None && bytes >= hugePageThreshold) {
+            if constexpr (Pages == HugePages::Transparent) std::free(pointer);
+            else munmap(pointer, roundToHugePages(bytes));
+            return;
+        }
+#endif
+        ::operator delete(pointer, std::align_val_t{Alignment});
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment, Pages>&) const { return true; }
+
+private:
+    static std::size_t roundToHugePages(std::size_t bytes) { return (bytes + hugePageSize - 1) / hugePageSize * hugePageSize; }
+};
+
+// Стратегия роста емкости: capacity * Numerator / Denominator, но не меньше capacity + 1
+template <std::size_t Numerator, std::size_t Denominator>
+struct GeometricGrowth {
+    static_assert(Numerator > Denominator, "growth factor must exceed 1");
+    static std::size_t next(std::size_t capacity) {
+        return std::max(capacity + 1, capacity / Denominator * Numerator + capacity % Denominator * Numerator / Denominator);
+    }
+};
+using DoublingGrowth = GeometricGrowth<2, 1>;     // Рост в 2 раза
+using OneAndHalfGrowth = GeometricGrowth<3, 2>;   // Рост в 1.5 раза (старые блоки могут переиспользоваться)
+
+// Перенос [first, last) в неинициализированную память destination; исходные объекты уничтожаются
+// Тривиально перемещаемые - memcpy, с noexcept-перемещением (или без копирования) - перемещение,
+// иначе копирование, чтобы при исключении исходные элементы остались целыми
+template <typename T>
+void relocateElements(T* first, T* last, T* destination) {
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if (first != last) {
+            std::memcpy(static_cast<void*>(destination), static_cast<const void*>(first), (last - first) * sizeof(T));
+        }
+    } else if constexpr (std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+        std::uninitialized_move(first, last, destination);
+        std::destroy(first, last);
+    } else {
+        std::uninitialized_copy(first, last, destination);
+        std::destroy(first, last);
+    }
+}
 
 // Класс Vector - собственная реализация динамического массива
+// Память выделяется распределителем без инициализации, элементы создаются на месте.
+// При росте элементы переносятся: тривиально перемещаемые - memcpy (или reallocate распределителя),
+// с noexcept-перемещением (или без копирования) - перемещением, остальные - копированием
+// Growth - стратегия роста емкости (DoublingGrowth, OneAndHalfGrowth)
+template <typename T, typename Allocator = std::allocator<T>, typename Growth = DoublingGrowth>
 class Vector {
 private:
+    using Traits = std::allocator_traits<Allocator>;
+
     // Приватные поля класса
-    int* m_data = nullptr;        // Указатель на массив данных
+    T* m_data = nullptr;          // Указатель на массив данных
     std::size_t m_size = 0;       // Текущее количество элементов
     std::size_t m_capacity = 0;   // Текущая емкость (размер выделенной памяти)
+    [[no_unique_address]] Allocator m_allocator;  // Распределитель памяти
+
+    // Можно ли переносить элементы через reallocate распределителя
+    static constexpr bool canReallocate = is_trivially_relocatable_v<T> &&
+        requires(Allocator allocator, T* pointer, std::size_t count) { allocator.reallocate(pointer, count, count); };
 
 public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
     // Конструктор по умолчанию - создает пустой вектор
     Vector() = default;  // Компилятор генерирует реализацию
+
+    // Конструктор с распределителем
+    explicit Vector(const Allocator& allocator) : m_allocator(allocator) {}
     
     // Конструктор с заданной начальной емкостью
-    Vector(std::size_t initial_capacity) : m_capacity(initial_capacity) {
-        // Если емкость больше 0, выделяем память
-        if (m_capacity > 0) {
-            m_data = new int[m_capacity];  // Выделение массива в куче
-        }
+    Vector(std::size_t initial_capacity, const Allocator& allocator = Allocator()) : m_allocator(allocator) {
+        reserve(initial_capacity);  // Память без создания элементов
     }
     
     // Конструктор из списка инициализации {1, 2, 3, 4}
-    Vector(std::initializer_list<int> list) : m_size(list.size()), m_capacity(list.size()) {
+    Vector(std::initializer_list<T> list, const Allocator& allocator = Allocator()) : m_allocator(allocator) {
         // Если список не пустой, копируем элементы
-        if (m_capacity > 0) {
-            m_data = new int[m_capacity];  // Выделение памяти
-            std::copy(list.begin(), list.end(), m_data);  // Копирование элементов
+        if (list.size() > 0) {
+            m_data = Traits::allocate(m_allocator, list.size());  // Выделение памяти
+            std::uninitialized_copy(list.begin(), list.end(), m_data);  // Копирование элементов
+            m_size = m_capacity = list.size();
         }
     }
     
     // Конструктор копирования (глубокое копирование)
-    Vector(const Vector& other) : m_size(other.m_size), m_capacity(other.m_capacity) {
+    Vector(const Vector& other)
+        : m_allocator(Traits::select_on_container_copy_construction(other.m_allocator)) {
         // Если исходный вектор не пустой, копируем его данные
-        if (m_capacity > 0) {
-            m_data = new int[m_capacity];  // Выделение новой памяти
-            std::copy(other.m_data, other.m_data + other.m_size, m_data);  // Копирование данных
+        if (other.m_size > 0) {
+            m_data = Traits::allocate(m_allocator, other.m_size);  // Выделение новой памяти
+            try {
+                std::uninitialized_copy(other.m_data, other.m_data + other.m_size, m_data);  // Копирование данных
+            } catch (...) {
+                Traits::deallocate(m_allocator, m_data, other.m_size);
+                throw;
+            }
+            m_size = m_capacity = other.m_size;
         }
     }
     
@@ -49,7 +276,8 @@ public:
     Vector(Vector&& other) noexcept  // noexcept - гарантия отсутствия исключений
         : m_data(std::exchange(other.m_data, nullptr)),      // Забираем указатель, обнуляем у other
           m_size(std::exchange(other.m_size, 0)),           // Забираем размер, обнуляем у other
-          m_capacity(std::exchange(other.m_capacity, 0)) {} // Забираем емкость, обнуляем у other
+          m_capacity(std::exchange(other.m_capacity, 0)),   // Забираем емкость, обнуляем у other
+          m_allocator(std::move(other.m_allocator)) {}      // Распределитель переходит вместе с памятью
     
     // Оператор присваивания (copy-and-swap идиома)
     Vector& operator=(Vector other) {  // Параметр передается по значению (копирование/перемещение)
@@ -57,9 +285,10 @@ public:
         return *this; // Возвращаем ссылку на текущий объект
     }
     
-    // Деструктор - освобождает выделенную память
+    // Деструктор - уничтожает элементы и освобождает память
     ~Vector() {
-        delete[] m_data;  // Освобождение массива, выделенного через new[]
+        std::destroy(m_data, m_data + m_size);  // Деструкторы элементов
+        if (m_data) Traits::deallocate(m_allocator, m_data, m_capacity);  // Освобождение памяти
     }
     
     // Метод обмена содержимым двух векторов
@@ -67,6 +296,7 @@ public:
         std::swap(m_data, other.m_data);        // Обмен указателями
         std::swap(m_size, other.m_size);        // Обмен размерами
         std::swap(m_capacity, other.m_capacity);// Обмен емкостями
+        std::swap(m_allocator, other.m_allocator); // Обмен распределителями
     }
     
     // Разделитель для лучшей читаемости кода
@@ -78,9 +308,19 @@ public:
     bool empty() const { return m_size == 0; }           // Проверка на пустоту
     
     // Оператор доступа к элементу по индексу (неконстантная версия)
-    int& operator[](std::size_t index) { return m_data[index]; }
+    T& operator[](std::size_t index) { return m_data[index]; }
     // Оператор доступа к элементу по индексу (константная версия)
-    const int& operator[](std::size_t index) const { return m_data[index]; }
+    const T& operator[](std::size_t index) const { return m_data[index]; }
+
+    // Доступ к памяти и обход
+    T* data() { return m_data; }
+    const T* data() const { return m_data; }
+    T* begin() { return m_data; }
+    T* end() { return m_data + m_size; }
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+    T& back() { return m_data[m_size - 1]; }
+    const T& back() const { return m_data[m_size - 1]; }
     
     // Метод резервирования памяти (увеличение емкости)
     void reserve(std::size_t new_capacity) {
@@ -88,46 +328,951 @@ public:
         if (new_capacity <= m_capacity)
             return;
 
-        // Выделяем новый массив большего размера
-        int *new_array = new int[new_capacity];
-
-        // Если в старом массиве были данные, копируем их
-        if (m_data) {
-            std::ranges::copy(m_data, m_data + m_size, new_array);  // Копирование данных
-            delete[] m_data;  // Освобождаем старую память
+        if constexpr (canReallocate) {
+            // Тривиально перемещаемые элементы переносит сам распределитель
+            m_data = m_data ? m_allocator.reallocate(m_data, m_capacity, new_capacity)
+                            : Traits::allocate(m_allocator, new_capacity);
+        } else {
+            // Выделяем неинициализированную память и переносим в нее элементы
+            T* new_array = Traits::allocate(m_allocator, new_capacity);
+            if (m_data) {
+                try {
+                    relocateElements(m_data, m_data + m_size, new_array);
+                } catch (...) {
+                    Traits::deallocate(m_allocator, new_array, new_capacity);
+                    throw;
+                }
+                Traits::deallocate(m_allocator, m_data, m_capacity);  // Освобождаем старую память
+            }
+            m_data = new_array;
         }
-
-        // Обновляем указатель и емкость
-        m_data = new_array;
         m_capacity = new_capacity;
     }
     
-    // Метод добавления элемента в конец вектора
-    void push_back(int value) {
-        // Если массив заполнен, увеличиваем емкость
+    // Метод добавления элемента в конец вектора (копия или перемещение)
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    // Создание элемента в конце вектора из аргументов конструктора
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        // Если массив заполнен, растем; аргументы могут ссылаться на элементы самого вектора
         if (m_size == m_capacity) {
-            // Стратегия роста: если емкость 0, резервируем 1, иначе удваиваем
-            reserve(m_capacity == 0 ? 1 : m_capacity * 2);
+            return growAndEmplace(std::forward<Args>(args)...);
         }
-
         // Добавляем элемент в конец
-        m_data[m_size] = value;
+        T* element = ::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
         ++m_size;  // Увеличиваем счетчик элементов
+        return *element;
+    }
+
+    // Удаление последнего элемента
+    void pop_back() {
+        --m_size;
+        std::destroy_at(m_data + m_size);
+    }
+
+    // Изменение размера: новые элементы инициализируются значением (для int - нулем)
+    void resize(std::size_t new_size) {
+        resizeWith(new_size, [](T* first, T* last) { std::uninitialized_value_construct(first, last); });
+    }
+
+    // Изменение размера: новые элементы - копии value
+    void resize(std::size_t new_size, const T& value) {
+        if (new_size > m_capacity && &value >= m_data && &value < m_data + m_size) { // value переедет при росте
+            T copy = value;
+            resize(new_size, copy);
+            return;
+        }
+        resizeWith(new_size, [&](T* first, T* last) { std::uninitialized_fill(first, last, value); });
+    }
+
+    // Изменение размера без обнуления: новые элементы инициализируются по умолчанию
+    // (для int, float и POD-структур - остаются неопределенными), их нужно перезаписать.
+    // Экономит проход записи нулей и, для свежей памяти, лишнее касание страниц
+    void resize_for_overwrite(std::size_t new_size) {
+        resizeWith(new_size, [](T* first, T* last) { std::uninitialized_default_construct(first, last); });
     }
     
     // Метод очистки вектора (не освобождает память)
     void clear() {
-        m_size = 0;  // Просто обнуляем размер - данные остаются в памяти
+        std::destroy(m_data, m_data + m_size);  // Деструкторы элементов
+        m_size = 0;  // Память остается для повторного использования
+    }
+
+    // Уменьшение емкости до размера (пустой вектор освобождает память)
+    void shrink_to_fit() {
+        if (m_size == m_capacity) return;
+        if (m_size == 0) {
+            Traits::deallocate(m_allocator, m_data, m_capacity);
+            m_data = nullptr;
+        } else if constexpr (canReallocate) {
+            m_data = m_allocator.reallocate(m_data, m_capacity, m_size);  // Уменьшение на месте
+        } else {
+            T* new_array = Traits::allocate(m_allocator, m_size);
+            try {
+                relocateElements(m_data, m_data + m_size, new_array);
+            } catch (...) {
+                Traits::deallocate(m_allocator, new_array, m_size);
+                throw;
+            }
+            Traits::deallocate(m_allocator, m_data, m_capacity);
+            m_data = new_array;
+        }
+        m_capacity = m_size;
     }
     
     // Разделитель для лучшей читаемости кода
     ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+private:
+    // Общая часть resize: construct(first, last) создает новые элементы в неинициализированной памяти
+    template <typename Construct>
+    void resizeWith(std::size_t new_size, Construct construct) {
+        if (new_size <= m_size) {
+            std::destroy(m_data + new_size, m_data + m_size);
+        } else {
+            reserve(std::max(new_size, std::min(grownCapacity(), new_size * 2)));
+            construct(m_data + m_size, m_data + new_size);
+        }
+        m_size = new_size;
+    }
+
+    // Стратегия роста: если емкость 0, резервируем 1, иначе по Growth
+    std::size_t grownCapacity() const { return m_capacity == 0 ? 1 : Growth::next(m_capacity); }
+
+    // Рост с созданием нового элемента: элемент создается раньше переноса старых,
+    // поэтому args может ссылаться на элемент этого же вектора
+    template <typename... Args>
+    T& growAndEmplace(Args&&... args) {
+        std::size_t new_capacity = grownCapacity();
+        if constexpr (canReallocate) {
+            T value(std::forward<Args>(args)...);  // Копия до reallocate: старый блок может быть освобожден
+            reserve(new_capacity);
+            T* element = ::new (static_cast<void*>(m_data + m_size)) T(std::move(value));
+            ++m_size;
+            return *element;
+        } else {
+            T* new_array = Traits::allocate(m_allocator, new_capacity);
+            T* element;
+            try {
+                element = ::new (static_cast<void*>(new_array + m_size)) T(std::forward<Args>(args)...);
+            } catch (...) {
+                Traits::deallocate(m_allocator, new_array, new_capacity);
+                throw;
+            }
+            if (m_data) {
+                try {
+                    relocateElements(m_data, m_data + m_size, new_array);
+                } catch (...) {
+                    std::destroy_at(element);
+                    Traits::deallocate(m_allocator, new_array, new_capacity);
+                    throw;
+                }
+                Traits::deallocate(m_allocator, m_data, m_capacity);
+            }
+            m_data = new_array;
+            m_capacity = new_capacity;
+            ++m_size;
+            return *element;
+        }
+    }
+};
+
+// Вектор с встроенным буфером на N элементов (small-buffer optimization)
+// Пока элементов не больше N, они лежат внутри объекта и куча не используется;
+// при росте сверх N элементы переносятся в память распределителя, как в Vector.
+// Семантика push_back/reserve/swap та же, что у Vector; указатели на элементы
+// встроенного буфера не переживают перемещение и swap объекта
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class SmallVector {
+    static_assert(N > 0, "inline capacity must be positive");
+
+private:
+    using Traits = std::allocator_traits<Allocator>;
+
+    T* m_data;                    // Встроенный буфер или память в куче
+    std::size_t m_size = 0;       // Текущее количество элементов
+    std::size_t m_capacity = N;   // Текущая емкость
+    [[no_unique_address]] Allocator m_allocator;  // Распределитель памяти для роста сверх N
+    alignas(T) std::byte m_inline[N * sizeof(T)]; // Встроенный буфер
+
+    T* inlineData() { return reinterpret_cast<T*>(m_inline); }
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+
+    SmallVector() : m_data(inlineData()) {}
+    explicit SmallVector(const Allocator& allocator) : m_data(inlineData()), m_allocator(allocator) {}
+
+    SmallVector(std::initializer_list<T> list, const Allocator& allocator = Allocator())
+        : m_data(inlineData()), m_allocator(allocator) {
+        reserve(list.size());
+        std::uninitialized_copy(list.begin(), list.end(), m_data);
+        m_size = list.size();
+    }
+
+    SmallVector(const SmallVector& other)
+        : m_data(inlineData()), m_allocator(Traits::select_on_container_copy_construction(other.m_allocator)) {
+        reserve(other.m_size);
+        std::uninitialized_copy(other.begin(), other.end(), m_data);
+        m_size = other.m_size;
+    }
+
+    // Перемещение: память в куче забирается целиком, встроенные элементы переносятся по одному
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : m_data(inlineData()), m_allocator(std::move(other.m_allocator)) {
+        if (!other.is_inline()) {
+            m_data = std::exchange(other.m_data, other.inlineData());
+            m_capacity = std::exchange(other.m_capacity, N);
+        } else {
+            relocateElements(other.m_data, other.m_data + other.m_size, m_data);
+        }
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+    // Оператор присваивания (copy-and-swap, как у Vector)
+    SmallVector& operator=(SmallVector other) {
+        swap(other);
+        return *this;
+    }
+
+    ~SmallVector() {
+        std::destroy(m_data, m_data + m_size);
+        if (!is_inline()) Traits::deallocate(m_allocator, m_data, m_capacity);
+    }
+
+    // Обмен содержимым: память в куче меняется указателями, встроенные элементы - переносом
+    void swap(SmallVector& other) {
+        if (this == &other) return;
+        std::swap(m_allocator, other.m_allocator);
+        if (!is_inline() && !other.is_inline()) { // Обе в куче
+            std::swap(m_data, other.m_data);
+            std::swap(m_capacity, other.m_capacity);
+        } else if (!is_inline() || !other.is_inline()) { // Одна в куче: встроенные элементы переезжают в буфер другой
+            SmallVector& heap = is_inline() ? other : *this;
+            SmallVector& small = is_inline() ? *this : other;
+            T* heapData = heap.m_data;
+            std::size_t heapCapacity = heap.m_capacity;
+            relocateElements(small.m_data, small.m_data + small.m_size, heap.inlineData());
+            heap.m_data = heap.inlineData();
+            heap.m_capacity = N;
+            small.m_data = heapData;
+            small.m_capacity = heapCapacity;
+        } else { // Оба встроенные: общая часть меняется, остаток длинного переносится в короткий
+            SmallVector& longer = m_size >= other.m_size ? *this : other;
+            SmallVector& shorter = m_size >= other.m_size ? other : *this;
+            std::swap_ranges(shorter.m_data, shorter.m_data + shorter.m_size, longer.m_data);
+            relocateElements(longer.m_data + shorter.m_size, longer.m_data + longer.m_size, shorter.m_data + shorter.m_size);
+        }
+        std::swap(m_size, other.m_size);
+    }
+
+    // Методы доступа к состоянию вектора
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_capacity; }
+    bool empty() const { return m_size == 0; }
+    // Элементы лежат во встроенном буфере
+    bool is_inline() const { return m_data == reinterpret_cast<const T*>(m_inline); }
+
+    T& operator[](std::size_t index) { return m_data[index]; }
+    const T& operator[](std::size_t index) const { return m_data[index]; }
+    T* data() { return m_data; }
+    const T* data() const { return m_data; }
+    T* begin() { return m_data; }
+    T* end() { return m_data + m_size; }
+    const T* begin() const { return m_data; }
+    const T* end() const { return m_data + m_size; }
+    T& back() { return m_data[m_size - 1]; }
+    const T& back() const { return m_data[m_size - 1]; }
+
+    // Резервирование: до N - ничего не делает, иначе перенос в кучу
+    void reserve(std::size_t new_capacity) {
+        if (new_capacity <= m_capacity) return;
+        T* new_array = Traits::allocate(m_allocator, new_capacity);
+        try {
+            relocateElements(m_data, m_data + m_size, new_array);
+        } catch (...) {
+            Traits::deallocate(m_allocator, new_array, new_capacity);
+            throw;
+        }
+        if (!is_inline()) Traits::deallocate(m_allocator, m_data, m_capacity);
+        m_data = new_array;
+        m_capacity = new_capacity;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    // Создание элемента в конце; при росте элемент создается до переноса старых (args может ссылаться на них)
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        if (m_size < m_capacity) {
+            T* element = ::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+            ++m_size;
+            return *element;
+        }
+        std::size_t new_capacity = m_capacity * 2;
+        T* new_array = Traits::allocate(m_allocator, new_capacity);
+        T* element;
+        try {
+            element = ::new (static_cast<void*>(new_array + m_size)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            Traits::deallocate(m_allocator, new_array, new_capacity);
+            throw;
+        }
+        try {
+            relocateElements(m_data, m_data + m_size, new_array);
+        } catch (...) {
+            std::destroy_at(element);
+            Traits::deallocate(m_allocator, new_array, new_capacity);
+            throw;
+        }
+        if (!is_inline()) Traits::deallocate(m_allocator, m_data, m_capacity);
+        m_data = new_array;
+        m_capacity = new_capacity;
+        ++m_size;
+        return *element;
+    }
+
+    void pop_back() {
+        --m_size;
+        std::destroy_at(m_data + m_size);
+    }
+
+    // Очистка (память в куче сохраняется, как у Vector)
+    void clear() {
+        std::destroy(m_data, m_data + m_size);
+        m_size = 0;
+    }
+};
+
+// Распределитель со счетчиком выделений (для бенчмарков и тестов)
+template <typename T>
+struct CountingAllocator {
+    using value_type = T;
+    static inline std::size_t allocations = 0;  // Число выделений для данного T
+
+    CountingAllocator() = default;
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>&) {}
+
+    T* allocate(std::size_t count) {
+        ++allocations;
+        return std::allocator<T>().allocate(count);
+    }
+    void deallocate(T* pointer, std::size_t count) { std::allocator<T>().deallocate(pointer, count); }
+
+    template <typename U>
+    bool operator==(const CountingAllocator<U>&) const { return true; }
+};
+
+// Бенчмарк коротких векторов: count векторов со случайным размером 0..24 (большинство меньше 16)
+// Число выделений памяти и время заполнения + суммирования
+void benchmarkSmall(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::vector<int> sizes(count);
+    for (auto& size : sizes) size = random_generator() % 100 < 90 ? random_generator() % 16 : 16 + random_generator() % 9;
+
+    auto run = [&](const char* title, auto make) {
+        using Container = decltype(make());
+        using Counter = CountingAllocator<int>;
+        Counter::allocations = 0;
+        long long checksum = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            Container vector = make();
+            for (int j = 0; j < sizes[i]; ++j) vector.push_back(j);
+            for (int value : vector) checksum += value;
+        }
+        auto end = std::chrono::steady_clock::now();
+        std::cout << "  " << title << ": " << std::chrono::duration<double, std::milli>(end - begin).count() << " ms, "
+                  << Counter::allocations << " allocations [checksum " << checksum << "]" << std::endl;
+    };
+    std::cout << count << " short vectors (size 0..24):" << std::endl;
+    run("std::vector", [] { return std::vector<int, CountingAllocator<int>>(); });
+    run("Vector", [] { return Vector<int, CountingAllocator<int>>(); });
+    run("SmallVector<16>", [] { return SmallVector<int, 16, CountingAllocator<int>>(); });
+}
+
+#if defined(__linux__)
+// Вектор в файле, отображенном в память: данные больше оперативной памяти строятся push_back,
+// открываются повторно без чтения (страницы подгружаются по обращению) и разделяются
+// между процессами только для чтения. Файл: заголовок на 4 КБ (сигнатура, размер элемента,
+// число элементов) и массив элементов. Файл растет экстентами (по умолчанию 64 МБ),
+// отображение расширяется mremap. Число элементов в заголовке обновляется в точках
+// flush/sync/закрытия: другой процесс видит только зафиксированную часть
+template <typename T>
+class MappedVector {
+    static_assert(std::is_trivially_copyable_v<T>, "file-backed elements must be trivially copyable");
+
+public:
+    // Режим открытия
+    enum class Mode {
+        Create,     // Новый пустой файл (существующий перезаписывается)
+        ReadWrite,  // Существующий файл для дополнения
+        ReadOnly    // Существующий файл только для чтения (разделяемое отображение)
+    };
+
+    // Подсказки ядру о характере доступа (madvise)
+    enum class Access {
+        Normal = MADV_NORMAL,
+        Sequential = MADV_SEQUENTIAL,  // Агрессивное упреждающее чтение
+        Random = MADV_RANDOM,          // Без упреждающего чтения
+        WillNeed = MADV_WILLNEED,      // Подгрузить заранее
+        DontNeed = MADV_DONTNEED       // Страницы можно вытеснить
+    };
+
+    static constexpr std::size_t headerBytes = 4096;  // Смещение данных (выровнено по странице)
+
+    MappedVector(const std::string& path, Mode mode, std::size_t extentBytes = std::size_t{64} << 20)
+        : m_writable(mode != Mode::ReadOnly), m_extentBytes(std::max(extentBytes, headerBytes)) {
+        int flags = mode == Mode::ReadOnly ? O_RDONLY : O_RDWR;
+        if (mode == Mode::Create) flags |= O_CREAT | O_TRUNC;
+        m_fd = ::open(path.c_str(), flags, 0644);
+        if (m_fd < 0) throw std::system_error(errno, std::generic_category(), "open " + path);
+        try {
+            if (mode == Mode::Create) {
+                resizeFile(headerBytes + m_extentBytes);
+                map(headerBytes + m_extentBytes);
+                *header() = Header{magic, sizeof(T), 0};
+            } else {
+                struct stat info;
+                if (fstat(m_fd, &info) != 0) throw std::system_error(errno, std::generic_category(), "fstat");
+                std::size_t fileBytes = static_cast<std::size_t>(info.st_size);
+                if (fileBytes < headerBytes) throw std::runtime_error("MappedVector: file too small");
+                map(fileBytes);
+                if (header()->magic != magic || header()->elementSize != sizeof(T)) {
+                    throw std::runtime_error("MappedVector: bad header");
+                }
+                m_size = header()->size;
+                if (headerBytes + m_size * sizeof(T) > fileBytes) throw std::runtime_error("MappedVector: truncated file");
+                if (!m_writable) m_capacity = m_size;  // push_back всегда уходит в reserve и отклоняется
+            }
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+
+    // Закрытие с фиксацией размера; ошибки деструктора не выбрасываются
+    ~MappedVector() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    // Методы доступа, как у Vector
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_capacity; }
+    bool empty() const { return m_size == 0; }
+    T& operator[](std::size_t index) { return data()[index]; }
+    const T& operator[](std::size_t index) const { return data()[index]; }
+    T* data() { return reinterpret_cast<T*>(m_mapping + headerBytes); }
+    const T* data() const { return reinterpret_cast<const T*>(m_mapping + headerBytes); }
+    T* begin() { return data(); }
+    T* end() { return data() + m_size; }
+    const T* begin() const { return data(); }
+    const T* end() const { return data() + m_size; }
+
+    // Резервирование: файл и отображение растут до целого числа экстентов
+    void reserve(std::size_t new_capacity) {
+        requireWritable();
+        if (new_capacity <= capacity()) return;
+        std::size_t dataBytes = (new_capacity * sizeof(T) + m_extentBytes - 1) / m_extentBytes * m_extentBytes;
+        resizeFile(headerBytes + dataBytes);
+        void* mapping = mremap(m_mapping, m_mappingBytes, headerBytes + dataBytes, MREMAP_MAYMOVE);
+        if (mapping == MAP_FAILED) throw std::system_error(errno, std::generic_category(), "mremap");
+        m_mapping = static_cast<std::byte*>(mapping);
+        m_mappingBytes = headerBytes + dataBytes;
+        m_capacity = dataBytes / sizeof(T);
+    }
+
+    // Добавление элемента в конец
+    void push_back(const T& value) {
+        if (m_size == capacity()) {
+            T copy = value;  // value может лежать в отображении, которое переедет
+            reserve(m_size + 1);
+            data()[m_size++] = copy;
+            return;
+        }
+        data()[m_size++] = value;
+    }
+
+    // Подсказка о характере доступа ко всему отображению
+    void advise(Access access) {
+        if (madvise(m_mapping, m_mappingBytes, static_cast<int>(access)) != 0) {
+            throw std::system_error(errno, std::generic_category(), "madvise");
+        }
+    }
+
+    // Точка фиксации: размер записывается в заголовок, запись страниц на диск запускается асинхронно
+    void flush() {
+        requireWritable();
+        header()->size = m_size;
+        if (msync(m_mapping, m_mappingBytes, MS_ASYNC) != 0) throw std::system_error(errno, std::generic_category(), "msync");
+    }
+
+    // Точка долговременной фиксации: возврат после записи данных и заголовка на диск
+    void sync() {
+        requireWritable();
+        header()->size = m_size;
+        if (msync(m_mapping, m_mappingBytes, MS_SYNC) != 0) throw std::system_error(errno, std::generic_category(), "msync");
+        if (fsync(m_fd) != 0) throw std::system_error(errno, std::generic_category(), "fsync");
+    }
+
+    // Закрытие: фиксация размера и обрезка неиспользованного хвоста экстента.
+    // Дескриптор закрывается и при ошибке обрезки, повторный close() ничего не делает
+    void close() {
+        if (m_fd < 0) return;
+        if (m_writable && m_mapping != nullptr) {
+            header()->size = m_size;
+            munmap(m_mapping, m_mappingBytes);
+            m_mapping = nullptr;
+            try {
+                resizeFile(headerBytes + m_size * sizeof(T));
+            } catch (...) {
+                release();
+                throw;
+            }
+        }
+        release();
+    }
+
+private:
+    static constexpr std::uint64_t magic = 0x31524f5443455656;  // "VVECTOR1"
+
+    struct Header {
+        std::uint64_t magic;        // Сигнатура формата
+        std::uint64_t elementSize;  // sizeof(T) при создании
+        std::uint64_t size;         // Число зафиксированных элементов
+    };
+
+    int m_fd = -1;                    // Дескриптор файла
+    bool m_writable;                  // Открыт для записи
+    std::size_t m_extentBytes;        // Шаг роста файла
+    std::byte* m_mapping = nullptr;   // Отображение файла (заголовок + данные)
+    std::size_t m_mappingBytes = 0;   // Размер отображения
+    std::size_t m_size = 0;           // Число элементов
+    std::size_t m_capacity = 0;       // Емкость для записи (только для чтения - равна m_size)
+
+    Header* header() { return reinterpret_cast<Header*>(m_mapping); }
+
+    void requireWritable() const {
+        if (!m_writable) throw std::logic_error("MappedVector: opened read-only");
+    }
+
+    void resizeFile(std::size_t bytes) {
+        if (ftruncate(m_fd, static_cast<off_t>(bytes)) != 0) throw std::system_error(errno, std::generic_category(), "ftruncate");
+    }
+
+    void map(std::size_t bytes) {
+        int protection = m_writable ? PROT_READ | PROT_WRITE : PROT_READ;
+        void* mapping = mmap(nullptr, bytes, protection, MAP_SHARED, m_fd, 0);
+        if (mapping == MAP_FAILED) throw std::system_error(errno, std::generic_category(), "mmap");
+        m_mapping = static_cast<std::byte*>(mapping);
+        m_mappingBytes = bytes;
+        m_capacity = (bytes - headerBytes) / sizeof(T);
+    }
+
+    // Снятие отображения и закрытие файла
+    void release() {
+        if (m_mapping != nullptr) munmap(m_mapping, m_mappingBytes);
+        if (m_fd >= 0) ::close(m_fd);
+        m_mapping = nullptr;
+        m_mappingBytes = 0;
+        m_capacity = 0;
+        m_fd = -1;
+    }
+};
+
+// Бенчмарк файлового вектора: построение, повторное открытие, последовательный и случайный проход
+// в сравнении с записью и загрузкой того же столбца через потоки (std::ofstream/std::ifstream)
+// Кэш страниц после записи теплый в обоих случаях; повторное открытие MappedVector не читает данные
+void benchmarkMapped(std::size_t count) {
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    auto directory = std::filesystem::temp_directory_path();
+    std::string mappedPath = (directory / "mapped_vector_benchmark.bin").string();
+    std::string streamPath = (directory / "stream_vector_benchmark.bin").string();
+    // Временные файлы удаляются при любом выходе, в том числе по исключению
+    struct TemporaryFiles {
+        std::vector<std::string> paths;
+        ~TemporaryFiles() {
+            std::error_code error;  // Ошибки удаления не выбрасываются из деструктора
+            for (const auto& path : paths) std::filesystem::remove(path, error);
+        }
+    } temporaryFiles{{mappedPath, streamPath}};
+    std::mt19937_64 random_generator(42);
+    std::vector<std::size_t> probes(std::min<std::size_t>(count, 10'000'000));
+    for (auto& probe : probes) probe = random_generator() % count;
+    long long checksum = 0;
+
+    double mappedBuild = measure([&] {
+        MappedVector<std::uint32_t> column(mappedPath, MappedVector<std::uint32_t>::Mode::Create);
+        for (std::size_t i = 0; i < count; ++i) column.push_back(static_cast<std::uint32_t>(i));
+    });
+    double mappedOpen, mappedSequential, mappedRandom;
+    {
+        std::unique_ptr<MappedVector<std::uint32_t>> column;
+        mappedOpen = measure([&] {
+            column = std::make_unique<MappedVector<std::uint32_t>>(mappedPath, MappedVector<std::uint32_t>::Mode::ReadOnly);
+        });
+        column->advise(MappedVector<std::uint32_t>::Access::Sequential);
+        mappedSequential = measure([&] { for (std::uint32_t value : *column) checksum += value; });
+        column->advise(MappedVector<std::uint32_t>::Access::Random);
+        mappedRandom = measure([&] { for (std::size_t probe : probes) checksum += (*column)[probe]; });
+    }
+
+    double streamBuild = measure([&] {
+        std::vector<std::uint32_t> column;
+        for (std::size_t i = 0; i < count; ++i) column.push_back(static_cast<std::uint32_t>(i));
+        std::ofstream file(streamPath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(column.data()), static_cast<std::streamsize>(column.size() * sizeof(std::uint32_t)));
+    });
+    std::vector<std::uint32_t> loaded;
+    double streamOpen = measure([&] {
+        std::ifstream file(streamPath, std::ios::binary);
+        loaded.resize(std::filesystem::file_size(streamPath) / sizeof(std::uint32_t));
+        file.read(reinterpret_cast<char*>(loaded.data()), static_cast<std::streamsize>(loaded.size() * sizeof(std::uint32_t)));
+    });
+    double streamSequential = measure([&] { for (std::uint32_t value : loaded) checksum += value; });
+    double streamRandom = measure([&] { for (std::size_t probe : probes) checksum += loaded[probe]; });
+
+    std::cout << count << " uint32 column (ms), build / reopen / sequential / " << probes.size() << " random:" << std::endl;
+    std::cout << "  MappedVector: " << mappedBuild << " / " << mappedOpen << " / " << mappedSequential << " / " << mappedRandom << std::endl;
+    std::cout << "  stream I/O:   " << streamBuild << " / " << streamOpen << " / " << streamSequential << " / " << streamRandom
+              << " [checksum " << checksum << "]" << std::endl;
+}
+#endif
+
+// Конкурентный вектор только для дополнения: многие потоки вызывают push_back/grow_by без блокировок
+// Элементы лежат в сегментах геометрически растущего размера (firstSegment, 2 * firstSegment, ...),
+// сегменты никогда не переносятся, поэтому ссылки и указатели на элементы стабильны.
+// Индекс выдается атомарным fetch_add; сегмент выделяет первый обратившийся к нему поток
+// (при гонке проигравший освобождает свою копию). size() - число выданных индексов: элементы
+// могут еще создаваться другими потоками, читать их следует после синхронизации с производителями
+template <typename T, std::size_t firstSegment = 64>
+class ConcurrentVector {
+    static_assert(std::has_single_bit(firstSegment), "first segment size must be a power of two");
+
+private:
+    static constexpr std::size_t maxSegments = 64;
+
+    std::atomic<T*> m_segments[maxSegments] = {};  // Сегменты (nullptr - еще не выделен)
+    std::atomic<std::size_t> m_size{0};             // Число выданных индексов
+
+    // Номер сегмента и его первый индекс для index
+    static std::size_t segmentOf(std::size_t index) { return std::bit_width(index / firstSegment + 1) - 1; }
+    static std::size_t segmentStart(std::size_t segment) { return firstSegment * ((std::size_t{1} << segment) - 1); }
+    static std::size_t segmentSize(std::size_t segment) { return firstSegment << segment; }
+
+    // Сегмент с выделением при первом обращении
+    T* segment(std::size_t number) {
+        T* memory = m_segments[number].load(std::memory_order_acquire);
+        if (memory != nullptr) return memory;
+        T* allocated = std::allocator<T>().allocate(segmentSize(number));
+        if (m_segments[number].compare_exchange_strong(memory, allocated, std::memory_order_acq_rel)) return allocated;
+        std::allocator<T>().deallocate(allocated, segmentSize(number));  // Другой поток успел раньше
+        return memory;
+    }
+
+    // Адрес ячейки index (сегмент выделяется при необходимости)
+    T* slot(std::size_t index) {
+        std::size_t number = segmentOf(index);
+        return segment(number) + (index - segmentStart(number));
+    }
+
+public:
+    ConcurrentVector() = default;
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    // Деструктор: к этому моменту других потоков у вектора нет
+    ~ConcurrentVector() {
+        std::size_t size = m_size.load();
+        for (std::size_t number = 0; number < maxSegments; ++number) {
+            T* memory = m_segments[number].load();
+            if (memory == nullptr) continue;
+            std::size_t start = segmentStart(number);
+            if (start < size) std::destroy(memory, memory + std::min(segmentSize(number), size - start));
+            std::allocator<T>().deallocate(memory, segmentSize(number));
+        }
+    }
+
+    // Добавление элемента; возвращаемая ссылка действительна все время жизни вектора
+    template <typename... Args>
+    T& emplace_back(Args&&... args) {
+        std::size_t index = m_size.fetch_add(1, std::memory_order_relaxed);
+        return *::new (static_cast<void*>(slot(index))) T(std::forward<Args>(args)...);
+    }
+    T& push_back(const T& value) { return emplace_back(value); }
+    T& push_back(T&& value) { return emplace_back(std::move(value)); }
+
+    // Добавление count копий value одним fetch_add; индексы [first, first + count) принадлежат вызывающему
+    // (могут проходить через границу сегментов). Возвращает first
+    std::size_t grow_by(std::size_t count, const T& value = T()) {
+        std::size_t first = m_size.fetch_add(count, std::memory_order_relaxed);
+        std::size_t index = first, end = first + count;
+        while (index < end) { // Заполнение по сегментам
+            std::size_t number = segmentOf(index);
+            std::size_t segmentEnd = std::min(end, segmentStart(number + 1));
+            T* memory = segment(number);
+            std::uninitialized_fill(memory + (index - segmentStart(number)), memory + (segmentEnd - segmentStart(number)), value);
+            index = segmentEnd;
+        }
+        return first;
+    }
+
+    // Число выданных индексов
+    std::size_t size() const { return m_size.load(std::memory_order_acquire); }
+    bool empty() const { return size() == 0; }
+
+    // Доступ к элементу (индекс из выданных и уже созданных)
+    T& operator[](std::size_t index) {
+        std::size_t number = segmentOf(index);
+        return m_segments[number].load(std::memory_order_acquire)[index - segmentStart(number)];
+    }
+    const T& operator[](std::size_t index) const {
+        std::size_t number = segmentOf(index);
+        return m_segments[number].load(std::memory_order_acquire)[index - segmentStart(number)];
+    }
+
+    // Обход по сегментам: function(element) для [0, size())
+    template <typename Function>
+    void for_each(Function function) const {
+        std::size_t size = this->size();
+        for (std::size_t number = 0; segmentStart(number) < size; ++number) {
+            const T* memory = m_segments[number].load(std::memory_order_acquire);
+            std::size_t count = std::min(segmentSize(number), size - segmentStart(number));
+            for (std::size_t i = 0; i < count; ++i) function(memory[i]);
+        }
+    }
 };
 
+// Бенчмарк параллельного дополнения: total элементов от 1, 2, 4, ..., maxThreads потоков
+// ConcurrentVector против Vector под std::mutex
+void benchmarkConcurrent(std::size_t total, std::size_t maxThreads) {
+    auto run = [&](std::size_t threads, auto push) {
+        std::vector<std::thread> workers;
+        auto begin = std::chrono::steady_clock::now();
+        for (std::size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                std::size_t share = total / threads + (t < total % threads ? 1 : 0);
+                for (std::size_t i = 0; i < share; ++i) push(static_cast<int>(i));
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    std::cout << total << " concurrent push_back (ms): threads, Vector + mutex / ConcurrentVector / grow_by(256)" << std::endl;
+    for (std::size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        Vector<int> locked;
+        std::mutex mutex;
+        double lockedTime = run(threads, [&](int value) {
+            std::lock_guard lock(mutex);
+            locked.push_back(value);
+        });
+        ConcurrentVector<int> concurrent;
+        double concurrentTime = run(threads, [&](int value) { concurrent.push_back(value); });
+        ConcurrentVector<int> batched;
+        double batchedTime = run(threads, [&](int value) { // Пачка из 256 элементов на каждый 256-й вызов
+            if (value % 256 == 0) batched.grow_by(256, value);
+        });
+        assert(locked.size() == total && concurrent.size() == total);
+        std::cout << "  " << threads << ": " << lockedTime << " / " << concurrentTime << " / " << batchedTime << std::endl;
+    }
+}
+
+// Векторизованное ядро прохода: сумма float (AVX-512 / AVX2, четыре аккумулятора, загрузки без
+// требования выравнивания - на невыровненном буфере часть загрузок пересекает кэш-линии)
+float sumKernel(const float* data, std::size_t count) {
+    std::size_t i = 0;
+    float result = 0.0f;
+#if defined(__AVX512F__)
+    __m512 sum0 = _mm512_setzero_ps(), sum1 = _mm512_setzero_ps(), sum2 = _mm512_setzero_ps(), sum3 = _mm512_setzero_ps();
+    for (; i + 64 <= count; i += 64) {
+        sum0 = _mm512_add_ps(sum0, _mm512_loadu_ps(data + i));
+        sum1 = _mm512_add_ps(sum1, _mm512_loadu_ps(data + i + 16));
+        sum2 = _mm512_add_ps(sum2, _mm512_loadu_ps(data + i + 32));
+        sum3 = _mm512_add_ps(sum3, _mm512_loadu_ps(data + i + 48));
+    }
+    result = _mm512_reduce_add_ps(_mm512_add_ps(_mm512_add_ps(sum0, sum1), _mm512_add_ps(sum2, sum3)));
+#elif defined(__AVX2__)
+    __m256 sum0 = _mm256_setzero_ps(), sum1 = _mm256_setzero_ps(), sum2 = _mm256_setzero_ps(), sum3 = _mm256_setzero_ps();
+    for (; i + 32 <= count; i += 32) {
+        sum0 = _mm256_add_ps(sum0, _mm256_loadu_ps(data + i));
+        sum1 = _mm256_add_ps(sum1, _mm256_loadu_ps(data + i + 8));
+        sum2 = _mm256_add_ps(sum2, _mm256_loadu_ps(data + i + 16));
+        sum3 = _mm256_add_ps(sum3, _mm256_loadu_ps(data + i + 24));
+    }
+    __m256 total = _mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3));
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(total), _mm256_extractf128_ps(total, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    result = _mm_cvtss_f32(_mm_add_ss(half, _mm_shuffle_ps(half, half, 1)));
+#endif
+    for (; i < count; ++i) result += data[i];  // Хвост (и весь массив без SIMD)
+    return result;
+}
+
+// Бенчмарк выравнивания и больших страниц: resize / resize_for_overwrite + заполнение,
+// последовательное SIMD-суммирование и случайные чтения (чувствительны к TLB) по count float
+void benchmarkAligned(std::size_t count) {
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    std::mt19937_64 random_generator(42);
+    std::vector<std::uint32_t> probes(std::min<std::size_t>(count, 1 << 24));
+    for (auto& probe : probes) probe = static_cast<std::uint32_t>(random_generator() % count);
+    double checksum = 0.0;
+
+    auto run = [&](const char* title, auto vector) {
+        double fillTime = measure([&] {
+            vector.resize_for_overwrite(count);
+            for (std::size_t i = 0; i < count; ++i) vector[i] = static_cast<float>(i % 1024);
+        });
+        double scanTime = measure([&] {
+            for (int pass = 0; pass < 5; ++pass) checksum += sumKernel(vector.data(), count);
+        });
+        double randomTime = measure([&] {
+            float sum = 0.0f;
+            for (std::uint32_t probe : probes) sum += vector[probe];
+            checksum += sum;
+        });
+        std::cout << "  " << title << " (offset " << reinterpret_cast<std::uintptr_t>(vector.data()) % 64 << "): "
+                  << fillTime << " / " << scanTime << " / " << randomTime << std::endl;
+    };
+
+    std::cout << count << " floats (ms), resize_for_overwrite + fill / 5 SIMD sums / " << probes.size() << " random reads:" << std::endl;
+    run("std::allocator      ", Vector<float>());
+    run("aligned 64          ", Vector<float, AlignedAllocator<float>>());
+    run("aligned + THP       ", Vector<float, AlignedAllocator<float, 64, HugePages::Transparent>>());
+    run("aligned + HUGETLB   ", Vector<float, AlignedAllocator<float, 64, HugePages::Explicit>>());
+
+    // Стоимость обнуления: resize против resize_for_overwrite (с последующей записью)
+    double zeroTime = measure([&] {
+        Vector<float, AlignedAllocator<float>> vector;
+        vector.resize(count);
+        for (std::size_t i = 0; i < count; ++i) vector[i] = 1.0f;
+        checksum += vector[count / 2];
+    });
+    double overwriteTime = measure([&] {
+        Vector<float, AlignedAllocator<float>> vector;
+        vector.resize_for_overwrite(count);
+        for (std::size_t i = 0; i < count; ++i) vector[i] = 1.0f;
+        checksum += vector[count / 2];
+    });
+    std::cout << "  resize + fill " << zeroTime << ", resize_for_overwrite + fill " << overwriteTime << " [checksum " << checksum << "]" << std::endl;
+}
+
+// Пиковое потребление физической памяти процессом (VmHWM, КБ); 0, если недоступно
+std::size_t peakResidentKilobytes() {
+    std::ifstream status("/proc/self/status");
+    std::string key;
+    while (status >> key) {
+        if (key == "VmHWM:") {
+            std::size_t value = 0;
+            status >> value;
+            return value;
+        }
+    }
+    return 0;
+}
+
+// Сброс пика потребления памяти (Linux: запись "5" в /proc/self/clear_refs)
+bool resetPeakResident() {
+    std::ofstream clear("/proc/self/clear_refs");
+    return static_cast<bool>(clear << "5" << std::flush);
+}
+
+// Бенчмарк роста больших векторов: время заполнения count элементов и пик памяти
+// Копирующий рост держит старый и новый буферы одновременно; mremap - только новый
+void benchmarkHuge(std::size_t count) {
+    auto run = [&](const char* title, auto vector) {
+        bool reset = resetPeakResident();
+        std::size_t before = peakResidentKilobytes();
+        auto begin = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < count; ++i) vector.push_back(static_cast<std::uint32_t>(i));
+        auto end = std::chrono::steady_clock::now();
+        std::size_t peak = peakResidentKilobytes();
+        std::cout << "  " << title << ": " << std::chrono::duration<double, std::milli>(end - begin).count() << " ms, peak RSS ";
+        if (reset) std::cout << peak / 1024 << " MB (+" << (peak - std::min(peak, before)) / 1024 << " MB)";
+        else std::cout << "n/a";
+        std::cout << ", capacity " << vector.capacity() * sizeof(std::uint32_t) / (1 << 20) << " MB" << std::endl;
+    };
+    std::cout << count << " uint32 push_back, growth:" << std::endl;
+    run("std::vector (copy, 2x)", std::vector<std::uint32_t>());
+    run("Vector (copy, 2x)", Vector<std::uint32_t>());
+    run("Vector (copy, 1.5x)", Vector<std::uint32_t, std::allocator<std::uint32_t>, OneAndHalfGrowth>());
+    run("Vector (realloc, 2x)", Vector<std::uint32_t, MallocAllocator<std::uint32_t>>());
+#if defined(__linux__)
+    run("Vector (mremap, 2x)", Vector<std::uint32_t, MmapAllocator<std::uint32_t>>());
+    run("Vector (mremap, 1.5x)", Vector<std::uint32_t, MmapAllocator<std::uint32_t>, OneAndHalfGrowth>());
+#endif
+}
+
+// Бенчмарк заполнения: count вызовов push_back/emplace_back без reserve
+// в std::vector, Vector и Vector с MallocAllocator (realloc для тривиально перемещаемых типов)
+void benchmark(std::size_t count) {
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - begin).count();
+    };
+    struct Point {
+        double x, y, z;
+    };
+    auto fill = [&](auto vector, auto make) {
+        return measure([&] {
+            for (std::size_t i = 0; i < count; ++i) vector.emplace_back(make(i));
+            assert(vector.size() == count);
+        });
+    };
+    auto makeInt = [](std::size_t i) { return static_cast<int>(i); };
+    auto makePoint = [](std::size_t i) { return Point{double(i), double(i) + 1, double(i) + 2}; };
+    auto makeShort = [](std::size_t i) { return std::string(i % 15, 'a'); };               // Помещается в SSO
+    auto makeLong = [](std::size_t i) { return std::string(32 + i % 16, 'b'); };         // В куче
+
+    std::cout << count << " push_back (ms): std::vector / Vector / Vector<MallocAllocator>" << std::endl;
+    std::cout << "  int: " << fill(std::vector<int>(), makeInt) << " / " << fill(Vector<int>(), makeInt) << " / "
+              << fill(Vector<int, MallocAllocator<int>>(), makeInt) << std::endl;
+    std::cout << "  Point: " << fill(std::vector<Point>(), makePoint) << " / " << fill(Vector<Point>(), makePoint) << " / "
+              << fill(Vector<Point, MallocAllocator<Point>>(), makePoint) << std::endl;
+    std::size_t strings = count / 10;
+    std::cout << "  " << strings << " short strings: " << measure([&] {
+        std::vector<std::string> vector;
+        for (std::size_t i = 0; i < strings; ++i) vector.emplace_back(makeShort(i));
+    }) << " / " << measure([&] {
+        Vector<std::string> vector;
+        for (std::size_t i = 0; i < strings; ++i) vector.emplace_back(makeShort(i));
+    }) << std::endl;
+    std::cout << "  " << strings << " long strings: " << measure([&] {
+        std::vector<std::string> vector;
+        for (std::size_t i = 0; i < strings; ++i) vector.emplace_back(makeLong(i));
+    }) << " / " << measure([&] {
+        Vector<std::string> vector;
+        for (std::size_t i = 0; i < strings; ++i) vector.emplace_back(makeLong(i));
+    }) << std::endl;
+}
+
 // Главная функция программы
-int main() {
+int main(int argc, char* argv[]) {
     // Тест 1: Создание пустого вектора
-    Vector vec;  // Создаем вектор с помощью конструктора по умолчанию
+    Vector<int> vec;  // Создаем вектор с помощью конструктора по умолчанию
     assert(vec.empty());  // Проверяем, что вектор пустой
     std::cout << "empty test passed \n";  // Сообщение об успешном тесте
     
@@ -147,6 +1292,230 @@ int main() {
     assert(vec.size() == 0);        // Проверяем, что размер стал 0
     assert(vec.capacity() == 32);   // Проверяем, что емкость сохранилась (после 20 элементов)
     std::cout << "vector.clear test passed \n";  // Сообщение об успехе
+
+    // Тест 4: Нетривиальный тип - рост переносит строки, emplace_back создает элемент на месте
+    Vector<std::string> strings;
+    for (int i = 0; i < 100; ++i) {
+        strings.emplace_back(static_cast<std::size_t>(i), 'x');  // std::string(count, char)
+    }
+    assert(strings.size() == 100 && strings[99] == std::string(99, 'x'));
+    strings.push_back(strings[0]);            // Аргумент - элемент самого вектора (без роста, емкость 128)
+    strings.emplace_back(strings[99]);
+    while (strings.size() < strings.capacity()) strings.push_back("fill");
+    strings.emplace_back(strings[50]);        // Рост с аргументом из старого буфера
+    assert(strings.back() == std::string(50, 'x') && strings[101] == std::string(99, 'x'));
+    Vector<std::string> copy = strings;       // Глубокое копирование
+    strings.pop_back();
+    assert(copy.size() == strings.size() + 1 && copy[50] == strings[50]);
+    Vector<std::string> moved = std::move(copy);
+    assert(copy.size() == 0 && moved.back() == std::string(50, 'x'));
+    std::cout << "non-trivial element type test passed \n";
+
+    // Тест 5: Тип только с перемещением и подсчет живых объектов
+    int alive = 0;  // Число живых объектов Tracked
+    struct Tracked {
+        std::unique_ptr<int> value;
+        int* alive;
+        Tracked(int v, int* counter) : value(std::make_unique<int>(v)), alive(counter) { ++*alive; }
+        Tracked(Tracked&& other) noexcept : value(std::move(other.value)), alive(other.alive) { ++*alive; }
+        ~Tracked() { --*alive; }
+    };
+    {
+        Vector<Tracked> tracked;
+        for (int i = 0; i < 1000; ++i) tracked.emplace_back(i, &alive);
+        assert(alive == 1000 && *tracked[999].value == 999);
+        tracked.pop_back();
+        assert(alive == 999);
+    }
+    assert(alive == 0);  // Все элементы уничтожены ровно один раз
+    std::cout << "move-only element type test passed \n";
+
+    // Тест 6: MallocAllocator - рост через realloc
+    Vector<int, MallocAllocator<int>> reallocated{1, 2, 3};
+    for (int i = 4; i <= 1000; ++i) reallocated.push_back(i);
+    reallocated.emplace_back(reallocated[0]);  // Аргумент из старого блока при росте
+    for (int i = 0; i < 1000; ++i) assert(reallocated[i] == i + 1);
+    assert(reallocated.back() == 1 && reallocated.capacity() == 1536);
+    std::cout << "realloc growth test passed \n";
+
+    // Тест 7: SmallVector - встроенный буфер, переход в кучу, swap и перемещение
+    using Small = SmallVector<std::string, 4, CountingAllocator<std::string>>;
+    CountingAllocator<std::string>::allocations = 0;
+    Small small{"a", "b"};
+    for (int i = 0; i < 2; ++i) small.push_back(std::string(40, 'c'));  // Длинные строки - в своей куче
+    assert(small.is_inline() && small.capacity() == 4 && CountingAllocator<std::string>::allocations == 0);
+    small.emplace_back(small[0]);  // Выход за встроенный буфер: аргумент из него же
+    assert(!small.is_inline() && small.capacity() == 8 && CountingAllocator<std::string>::allocations == 1);
+    assert(small[0] == "a" && small[4] == "a" && small[3] == std::string(40, 'c'));
+    Small other{"x"};
+    small.swap(other);  // Куча <-> встроенный
+    assert(small.is_inline() && small.size() == 1 && small[0] == "x");
+    assert(!other.is_inline() && other.size() == 5 && other[1] == "b");
+    Small third{"p", "q", "r"};
+    small.swap(third);  // Встроенный <-> встроенный разного размера
+    assert(small.size() == 3 && small[2] == "r" && third.size() == 1 && third[0] == "x");
+    Small fromHeap = std::move(other);  // Перемещение из кучи - без выделений
+    assert(other.empty() && other.is_inline() && fromHeap.size() == 5 && CountingAllocator<std::string>::allocations == 1);
+    Small movedInline = std::move(small);  // Перемещение встроенных элементов
+    assert(movedInline.size() == 3 && movedInline[0] == "p" && movedInline.is_inline());
+    Small smallCopy = fromHeap;  // Копия 5 элементов - одно выделение
+    assert(smallCopy.size() == 5 && smallCopy[4] == "a" && CountingAllocator<std::string>::allocations == 2);
+    smallCopy.reserve(3);  // Не уменьшает емкость
+    assert(smallCopy.capacity() == 5);  // Копия выделяет ровно size()
+    std::cout << "SmallVector test passed \n";
+
+    // Тест 8: стратегия роста и shrink_to_fit
+    Vector<int, std::allocator<int>, OneAndHalfGrowth> slow;
+    std::vector<std::size_t> capacities;
+    for (int i = 0; i < 20; ++i) {
+        slow.push_back(i);
+        if (capacities.empty() || capacities.back() != slow.capacity()) capacities.push_back(slow.capacity());
+    }
+    assert((capacities == std::vector<std::size_t>{1, 2, 3, 4, 6, 9, 13, 19, 28}));
+    slow.shrink_to_fit();
+    assert(slow.capacity() == 20 && slow[19] == 19);
+    Vector<std::string> shrunk;
+    for (int i = 0; i < 5; ++i) shrunk.emplace_back(30, static_cast<char>('a' + i));
+    shrunk.shrink_to_fit();
+    assert(shrunk.capacity() == 5 && shrunk[4] == std::string(30, 'e'));
+    shrunk.clear();
+    shrunk.shrink_to_fit();
+    assert(shrunk.capacity() == 0 && shrunk.data() == nullptr);
+    shrunk.push_back("again");
+    assert(shrunk.size() == 1 && shrunk.capacity() == 1);
+#if defined(__linux__)
+    // mremap: рост с сохранением содержимого через границы страниц и уменьшение
+    Vector<std::uint64_t, MmapAllocator<std::uint64_t>> mapped;
+    for (std::uint64_t i = 0; i < 1'000'000; ++i) mapped.push_back(i * i);
+    for (std::uint64_t i = 0; i < 1'000'000; i += 4099) assert(mapped[i] == i * i);
+    mapped.shrink_to_fit();
+    assert(mapped.capacity() == 1'000'000 && mapped[999'999] == 999'999ULL * 999'999ULL);
+#endif
+    std::cout << "growth policy and shrink_to_fit test passed \n";
+
+#if defined(__linux__)
+    // Тест 9: MappedVector - построение, фиксация, повторное открытие, дополнение, только чтение
+    {
+        using Column = MappedVector<std::uint64_t>;
+        std::string path = (std::filesystem::temp_directory_path() / "mapped_vector_test.bin").string();
+        {
+            Column column(path, Column::Mode::Create, 1 << 16);  // Экстенты по 64 КБ - несколько mremap
+            for (std::uint64_t i = 0; i < 100'000; ++i) column.push_back(i * 3);
+            assert(column.size() == 100'000 && column.capacity() >= 100'000 && column[99'999] == 299'997);
+            column.sync();
+            Column reader(path, Column::Mode::ReadOnly);  // Второе отображение видит зафиксированные данные
+            assert(reader.size() == 100'000 && reader[12'345] == 37'035);
+            column.push_back(1);  // Не зафиксировано - читатель, открытый позже, не увидит
+            Column late(path, Column::Mode::ReadOnly);
+            assert(late.size() == 100'000);
+            bool threw = false;
+            try {
+                late.push_back(0);
+            } catch (const std::logic_error&) {
+                threw = true;
+            }
+            assert(threw);
+        }
+        assert(std::filesystem::file_size(path) == Column::headerBytes + 100'001 * sizeof(std::uint64_t));  // Хвост обрезан
+        {
+            Column column(path, Column::Mode::ReadWrite);
+            assert(column.size() == 100'001 && column[100'000] == 1);
+            for (std::uint64_t i = 0; i < 50'000; ++i) column.push_back(column[i]);  // Аргумент из отображения при росте
+            column.advise(Column::Access::Sequential);
+            std::uint64_t sum = 0;
+            for (std::uint64_t value : column) sum += value;
+            assert(column.size() == 150'001 && sum == 3 * (99'999ULL * 100'000 / 2) + 1 + 3 * (49'999ULL * 50'000 / 2));
+        }
+        std::filesystem::remove(path);
+    }
+    std::cout << "MappedVector test passed \n";
+#endif
+
+    // Тест 10: ConcurrentVector - 8 потоков, все значения на месте, ссылки стабильны
+    {
+        ConcurrentVector<std::uint64_t, 4> concurrent;
+        std::uint64_t& first = concurrent.push_back(7);
+        std::vector<std::thread> workers;
+        for (std::uint64_t t = 0; t < 8; ++t) {
+            workers.emplace_back([&, t] {
+                for (std::uint64_t i = 0; i < 20'000; ++i) {
+                    if (i % 100 == 0) concurrent.grow_by(3, t << 32 | i);  // Три копии одного значения
+                    else concurrent.push_back(t << 32 | i);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        assert(&concurrent[0] == &first && first == 7);  // Сегмент не переносился
+        assert(concurrent.size() == 1 + 8 * (20'000 + 2 * 200));
+        std::vector<std::uint64_t> seen;
+        concurrent.for_each([&](std::uint64_t value) { seen.push_back(value); });
+        std::sort(seen.begin(), seen.end());
+        std::vector<std::uint64_t> expected{7};
+        for (std::uint64_t t = 0; t < 8; ++t) {
+            for (std::uint64_t i = 0; i < 20'000; ++i) {
+                for (int copy = 0; copy < (i % 100 == 0 ? 3 : 1); ++copy) expected.push_back(t << 32 | i);
+            }
+        }
+        std::sort(expected.begin(), expected.end());
+        assert(seen == expected);
+        ConcurrentVector<std::string> strings;  // Нетривиальный тип: деструкторы в ~ConcurrentVector
+        for (int i = 0; i < 1000; ++i) strings.emplace_back(40, 'z');
+        assert(strings[999] == std::string(40, 'z'));
+    }
+    std::cout << "ConcurrentVector test passed \n";
+
+    // Тест 11: AlignedAllocator и resize
+    {
+        Vector<float, AlignedAllocator<float, 128>> aligned;
+        for (int i = 0; i < 1000; ++i) {
+            aligned.push_back(static_cast<float>(i));
+            assert(reinterpret_cast<std::uintptr_t>(aligned.data()) % 128 == 0);  // После каждого роста
+        }
+        Vector<double, AlignedAllocator<double, 64, HugePages::Transparent>> huge;
+        huge.resize(1 << 20);  // 8 МБ - путь больших страниц
+        assert(reinterpret_cast<std::uintptr_t>(huge.data()) % (std::size_t{2} << 20) == 0 && huge[12345] == 0.0);
+        Vector<double, AlignedAllocator<double, 64, HugePages::Explicit>> explicitHuge;
+        explicitHuge.resize(1 << 19, 2.5);
+        assert(explicitHuge[0] == 2.5 && explicitHuge[(1 << 19) - 1] == 2.5);
+        assert(std::abs(sumKernel(aligned.data(), 1000) - 499'500.0f) < 1.0f);
+
+        Vector<std::string> strings{"a", "b"};
+        strings.resize(5, strings[0]);  // Значение из самого вектора при росте
+        assert(strings.size() == 5 && strings[4] == "a");
+        strings.resize(1);
+        assert(strings.size() == 1 && strings[0] == "a");
+        strings.resize(3);
+        assert(strings[2].empty());
+        Vector<int> ints;
+        ints.resize_for_overwrite(100);
+        for (int i = 0; i < 100; ++i) ints[i] = i;
+        ints.resize(150);
+        assert(ints.size() == 150 && ints[99] == 99 && ints[149] == 0);
+    }
+    std::cout << "AlignedAllocator and resize test passed \n";
+
+    // Размер бенчмарка из аргументов командной строки (по умолчанию 1e7)
+    std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    benchmark(count);
+    benchmarkSmall(count / 10);
+    // Размер бенчмарка большого роста (по умолчанию 2^24 + 1 элементов uint32: сразу за границей
+    // удвоения - худший случай для копирующего роста). Гигабайтный случай - 134217729 (2^27 + 1)
+    // через аргумент: старые 512 МБ и скопированные 512 МБ одновременно
+    std::size_t hugeCount = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : (std::size_t{1} << 24) + 1;
+    benchmarkHuge(hugeCount);
+    // Число потоков бенчмарка конкурентного дополнения (по умолчанию до 64)
+    std::size_t maxThreads = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 64;
+    benchmarkConcurrent(count, maxThreads);
+    // Размер бенчмарка выравнивания (по умолчанию 1e7 float - 40 МБ; огромные страницы заметны
+    // на гигабайтных массивах, например 268435456 = 2^28 float через аргумент)
+    std::size_t alignedCount = argc > 5 ? std::strtoull(argv[5], nullptr, 10) : 10'000'000;
+    benchmarkAligned(alignedCount);
+#if defined(__linux__)
+    // Размер бенчмарка файлового вектора (по умолчанию 1e7 элементов uint32 - 40 МБ на файл;
+    // временный каталог часто в tmpfs, то есть в памяти). Гигабайтный файл - 250000000 через аргумент
+    std::size_t mappedCount = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 10'000'000;
+    benchmarkMapped(mappedCount);
+#endif
     
     return 0;  // Успешное завершение программы
 }
\ No newline at end of file
@@ -4,6 +4,31 @@
 #include <cstdint>      // Для целочисленных типов фиксированного размера (std::uint8_t)
 #include <sstream>      // Для работы со строковыми потоками (std::stringstream)
 #include <cassert>      // Для макроса assert (проверка условий)
+#include <algorithm>    // Для std::min, std::max
+#include <charconv>     // Для std::from_chars_result
+#include <chrono>       // Для измерения времени в бенчмарке
+#include <cstddef>      // Для std::size_t
+#include <cstdlib>      // Для std::strtoull (размер из аргументов)
+#include <cstring>      // Для std::memchr, std::memcpy
+#include <filesystem>   // Для временного файла бенчмарка
+#include <fstream>      // Для записи файла бенчмарка
+#include <optional>     // Для std::optional (результат parse)
+#include <random>       // Для генерации адресов в тестах и бенчмарке
+#include <span>         // Для std::span (пакетное форматирование)
+#include <string>       // Для std::string
+#include <string_view>  // Для std::string_view (разбор без выделений)
+#include <system_error> // Для std::errc, std::system_error
+#include <thread>       // Для std::thread (параллельный разбор)
+#include <vector>       // Для std::vector (результаты пакетного разбора)
+#if defined(__SSSE3__)
+#include <immintrin.h>  // Для SIMD-интринсиков (SSSE3: pshufb, pmaddubsw)
+#endif
+#if defined(__linux__)
+#include <fcntl.h>      // Для open
+#include <sys/mman.h>   // Для mmap, madvise, munmap
+#include <sys/stat.h>   // Для fstat
+#include <unistd.h>     // Для close
+#endif
 
 // Класс для представления IPv4 адреса
 class IPv4 {
@@ -125,10 +150,416 @@ public:
         
         return ss;  // Возвращаем поток для цепочки операций
     }
+
+    // Разбор адреса a.b.c.d с начала [first, last) в стиле std::from_chars: без выделений памяти,
+    // ptr - первый символ после адреса. Строгая проверка: ровно 4 октета по 1-3 цифры,
+    // значения 0-255, без ведущих нулей ("01") и знаков. При ошибке ec = invalid_argument,
+    // ptr = first, value не меняется
+    friend std::from_chars_result from_chars(const char* first, const char* last, IPv4& value) {
+        std::array<std::uint8_t, 4> octets;
+        const char* end = nullptr;
+#if defined(__SSSE3__)
+        if (last - first >= 16) end = parseSimd(first, octets);  // Нужны 16 доступных байт
+#endif
+        if (end == nullptr) end = parseScalar(first, last, octets);  // Короткий ввод или необычный случай
+        if (end == nullptr) return {first, std::errc::invalid_argument};
+        value.data = octets;
+        return {end, std::errc{}};
+    }
+
+    // Разбор всей строки; std::nullopt, если это не ровно один адрес
+    static std::optional<IPv4> parse(std::string_view text) {
+        IPv4 result;
+        auto [end, error] = from_chars(text.data(), text.data() + text.size(), result);
+        if (error != std::errc{} || end != text.data() + text.size()) return std::nullopt;
+        return result;
+    }
+
+    // Запись адреса в [first, last) в стиле std::to_chars: без выделений памяти и потоков,
+    // октеты берутся из таблицы готовых строк. При нехватке места ec = value_too_large, ptr = last
+    friend std::to_chars_result to_chars(char* first, char* last, const IPv4& value) {
+        if (last - first >= 16) return {formatUnchecked(first, value), std::errc{}};  // Место под 4-байтовые записи
+        char buffer[16];
+        std::size_t length = static_cast<std::size_t>(formatUnchecked(buffer, value) - buffer);
+        if (static_cast<std::size_t>(last - first) < length) return {last, std::errc::value_too_large};
+        std::memcpy(first, buffer, length);
+        return {first + length, std::errc{}};
+    }
+
+    // Октет с номером index (0 - старший)
+    std::uint8_t octet(int index) const { return data[index]; }
+
+    // Строка "a.b.c.d" (до 15 символов)
+    std::string to_string() const {
+        char buffer[16];
+        return std::string(buffer, formatUnchecked(buffer, *this));
+    }
+
+    // Запись без проверки границ: каждый октет копируется 4 байтами (3 символа + длина),
+    // поэтому может испортить до 3 байт после результата; требует 16 байт в буфере
+    static char* formatUnchecked(char* out, const IPv4& value) {
+        for (int i = 0; i < 4; ++i) {
+            const auto& octet = octetTable[value.data[i]];
+            std::memcpy(out, octet.data(), 4);
+            out += octet[3];
+            *out = '.';  // Последняя точка лишняя и остается за концом результата
+            out += i < 3;
+        }
+        return out;
+    }
+
+    // Десятичные строки всех 256 октетов: до 3 символов и длина в последнем байте
+    static constexpr auto octetTable = [] {
+        std::array<std::array<char, 4>, 256> table{};
+        for (unsigned value = 0; value < 256; ++value) {
+            char digits[3] = {static_cast<char>('0' + value / 100), static_cast<char>('0' + value / 10 % 10), static_cast<char>('0' + value % 10)};
+            unsigned length = value >= 100 ? 3 : value >= 10 ? 2 : 1;
+            for (unsigned i = 0; i < length; ++i) table[value][i] = digits[3 - length + i];
+            table[value][3] = static_cast<char>(length);
+        }
+        return table;
+    }();
+
+    // Скалярный разбор; nullptr при ошибке
+    static const char* parseScalar(const char* first, const char* last, std::array<std::uint8_t, 4>& octets) {
+        const char* position = first;
+        for (int i = 0; i < 4; ++i) {
+            if (i > 0) { // Разделитель
+                if (position == last || *position != '.') return nullptr;
+                ++position;
+            }
+            const char* start = position;
+            unsigned octet = 0;
+            while (position != last && *position >= '0' && *position <= '9') {
+                if (position - start == 3) return nullptr;  // Больше трех цифр
+                octet = octet * 10 + static_cast<unsigned>(*position - '0');
+                ++position;
+            }
+            if (position == start || octet > 255) return nullptr;          // Нет цифр или больше 255
+            if (position - start > 1 && *start == '0') return nullptr;      // Ведущий ноль
+            octets[i] = static_cast<std::uint8_t>(octet);
+        }
+        return position;
+    }
+
+#if defined(__SSSE3__)
+    // SIMD-разбор 16 байт с first: маски цифр и точек дают длины октетов, по ним из таблицы
+    // берется перестановка, раскладывающая цифры в 4 дорожки [сотни, десятки, единицы, 0],
+    // а pmaddubsw + pmaddwd собирают значения октетов. nullptr - случай для скалярного разбора
+    // (ошибка или адрес, за которым в тех же 16 байтах идут цифры/точки)
+    static const char* parseSimd(const char* first, std::array<std::uint8_t, 4>& octets) {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        __m128i digits = _mm_sub_epi8(input, _mm_set1_epi8('0'));
+        // Цифры: (byte - '0') как беззнаковое < 10
+        unsigned digitMask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits)));
+        unsigned dotMask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(input, _mm_set1_epi8('.'))));
+        unsigned tokenMask = digitMask | dotMask;
+        if (tokenMask == 0xFFFF) return nullptr;  // Нет конца адреса в 16 байтах
+        unsigned length = static_cast<unsigned>(__builtin_ctz(~tokenMask));  // Длина цепочки цифр и точек
+        unsigned dots = dotMask & ((1u << length) - 1);
+        if (__builtin_popcount(dots) != 3) return nullptr;
+        unsigned dot1 = static_cast<unsigned>(__builtin_ctz(dots));
+        dots &= dots - 1;
+        unsigned dot2 = static_cast<unsigned>(__builtin_ctz(dots));
+        dots &= dots - 1;
+        unsigned dot3 = static_cast<unsigned>(__builtin_ctz(dots));
+        unsigned length0 = dot1, length1 = dot2 - dot1 - 1, length2 = dot3 - dot2 - 1, length3 = length - dot3 - 1;
+        if (length0 - 1 > 2 || length1 - 1 > 2 || length2 - 1 > 2 || length3 - 1 > 2) return nullptr;  // Длина не 1-3
+        // Ведущие нули: первая цифра октета длиной больше 1 равна '0'
+        unsigned zeroMask = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(input, _mm_set1_epi8('0'))));
+        unsigned leading = (length0 > 1 ? 1u : 0u) | (length1 > 1 ? 1u << (dot1 + 1) : 0u) |
+                           (length2 > 1 ? 1u << (dot2 + 1) : 0u) | (length3 > 1 ? 1u << (dot3 + 1) : 0u);
+        if (zeroMask & leading) return nullptr;
+
+        const auto& pattern = shuffleTable[(length0 - 1) * 27 + (length1 - 1) * 9 + (length2 - 1) * 3 + (length3 - 1)];
+        __m128i lanes = _mm_shuffle_epi8(digits, _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern.data())));
+        // [h, t, o, 0] * [100, 10, 1, 0] -> (100h + 10t, o) -> 100h + 10t + o
+        __m128i pairs = _mm_maddubs_epi16(lanes, _mm_set1_epi32(0x00010A64));
+        __m128i values = _mm_madd_epi16(pairs, _mm_set1_epi16(1));
+        if (_mm_movemask_epi8(_mm_cmpgt_epi32(values, _mm_set1_epi32(255))) != 0) return nullptr;  // Больше 255
+        std::uint32_t packed = static_cast<std::uint32_t>(_mm_cvtsi128_si32(_mm_shuffle_epi8(values, _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1))));
+        std::memcpy(octets.data(), &packed, 4);
+        return first + length;
+    }
+
+    // Перестановки pshufb для 81 сочетания длин октетов (1-3 цифры каждый)
+    static constexpr auto shuffleTable = [] {
+        std::array<std::array<std::uint8_t, 16>, 81> table{};
+        for (unsigned index = 0; index < 81; ++index) {
+            unsigned lengths[4] = {index / 27 + 1, index / 9 % 3 + 1, index / 3 % 3 + 1, index % 3 + 1};
+            unsigned start = 0;
+            for (unsigned octet = 0; octet < 4; ++octet) {
+                for (unsigned lane = 0; lane < 4; ++lane) {
+                    // Цифры выравниваются вправо в первых трех байтах дорожки
+                    int digit = static_cast<int>(lane) - static_cast<int>(3 - lengths[octet]);
+                    table[index][octet * 4 + lane] = lane < 3 && digit >= 0 ? static_cast<std::uint8_t>(start + digit) : 0x80;
+                }
+                start += lengths[octet] + 1;
+            }
+        }
+        return table;
+    }();
+#endif
 };
 
+// Результат пакетного разбора: адреса в порядке строк и число строк без корректного адреса
+struct BulkParseResult {
+    std::vector<IPv4> addresses;
+    std::size_t invalidLines = 0;
+};
+
+// Пакетный разбор журнала: в каждой непустой строке адрес стоит в начале и отделен пробелом,
+// табуляцией или концом строки. Текст делится на threads частей по границам строк,
+// каждая часть разбирается в своем потоке, результаты объединяются в порядке строк
+BulkParseResult parseAddresses(std::string_view text, unsigned threads = std::thread::hardware_concurrency()) {
+    threads = std::max(1u, threads);
+    if (text.size() < (std::size_t{1} << 16)) threads = 1;  // Малый ввод - без потоков
+    // Границы частей: после ближайшего перевода строки
+    std::vector<std::size_t> bounds(threads + 1, text.size());
+    bounds[0] = 0;
+    for (unsigned t = 1; t < threads; ++t) {
+        std::size_t position = std::max(bounds[t - 1], text.size() / threads * t);
+        std::size_t newline = text.find('\n', position);
+        bounds[t] = newline == std::string_view::npos ? text.size() : newline + 1;
+    }
+    std::vector<BulkParseResult> parts(threads);
+    auto worker = [&](unsigned t) {
+        const char* position = text.data() + bounds[t];
+        const char* end = text.data() + bounds[t + 1];
+        auto& part = parts[t];
+        part.addresses.reserve((bounds[t + 1] - bounds[t]) / 16);
+        while (position < end) {
+            const char* lineEnd = static_cast<const char*>(std::memchr(position, '\n', static_cast<std::size_t>(end - position)));
+            if (lineEnd == nullptr) lineEnd = end;
+            if (lineEnd != position) { // Пустые строки пропускаются
+                IPv4 address;
+                // Разбор не выходит за конец текста (SIMD-путь читает 16 байт только при их наличии)
+                auto [next, error] = from_chars(position, text.data() + text.size(), address);
+                if (error == std::errc{} && (next == lineEnd || *next == ' ' || *next == '\t' || *next == '\r')) {
+                    part.addresses.push_back(address);
+                } else {
+                    ++part.invalidLines;
+                }
+            }
+            position = lineEnd + 1;
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(worker, t);
+    worker(0);
+    for (auto& thread : workers) thread.join();
+
+    BulkParseResult result;
+    std::size_t total = 0;
+    for (auto& part : parts) total += part.addresses.size();
+    result.addresses.reserve(total);
+    for (auto& part : parts) {
+        result.addresses.insert(result.addresses.end(), part.addresses.begin(), part.addresses.end());
+        result.invalidLines += part.invalidLines;
+    }
+    return result;
+}
+
+// Пакетное форматирование: адреса через перевод строки (после каждого адреса).
+// Первый проход считает длины частей, второй пишет части в своих потоках по своим смещениям
+std::string formatAddresses(std::span<const IPv4> addresses, unsigned threads = std::thread::hardware_concurrency()) {
+    threads = std::max(1u, threads);
+    if (addresses.size() < (std::size_t{1} << 14)) threads = 1;  // Малый ввод - без потоков
+    auto lengthOf = [](const IPv4& address) { // Длины октетов из таблицы + 3 точки + перевод строки
+        std::size_t length = 4;
+        for (int i = 0; i < 4; ++i) length += static_cast<std::size_t>(IPv4::octetTable[address.octet(i)][3]);
+        return length;
+    };
+    std::vector<std::size_t> bounds(threads + 1), offsets(threads + 1, 0);
+    for (unsigned t = 0; t <= threads; ++t) bounds[t] = addresses.size() / threads * t;
+    bounds[threads] = addresses.size();
+    std::vector<std::thread> workers;
+    auto run = [&](auto&& function) { // Запуск function(t) во всех потоках
+        for (unsigned t = 1; t < threads; ++t) workers.emplace_back(function, t);
+        function(0);
+        for (auto& thread : workers) thread.join();
+        workers.clear();
+    };
+    run([&](unsigned t) {
+        std::size_t length = 0;
+        for (std::size_t i = bounds[t]; i < bounds[t + 1]; ++i) length += lengthOf(addresses[i]);
+        offsets[t + 1] = length;
+    });
+    for (unsigned t = 0; t < threads; ++t) offsets[t + 1] += offsets[t];
+
+    std::string result;
+    result.resize_and_overwrite(offsets[threads], [&](char* data, std::size_t size) {
+        run([&](unsigned t) {
+            char* out = data + offsets[t];
+            char* end = data + offsets[t + 1];  // Граница части: запись не заходит в соседнюю
+            for (std::size_t i = bounds[t]; i < bounds[t + 1]; ++i) {
+                out = to_chars(out, end, addresses[i]).ptr;
+                *out++ = '\n';
+            }
+        });
+        return size;
+    });
+    return result;
+}
+
+#if defined(__linux__)
+// Пакетный разбор файла журнала через отображение в память (без чтения в буфер)
+BulkParseResult parseAddressFile(const std::string& path, unsigned threads = std::thread::hardware_concurrency()) {
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) throw std::system_error(errno, std::generic_category(), "open " + path);
+    struct stat info;
+    if (fstat(descriptor, &info) != 0) {
+        int error = errno;
+        ::close(descriptor);
+        throw std::system_error(error, std::generic_category(), "fstat");
+    }
+    std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (size == 0) {
+        ::close(descriptor);
+        return {};
+    }
+    void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    ::close(descriptor);  // Отображение остается действительным
+    if (mapping == MAP_FAILED) throw std::system_error(errno, std::generic_category(), "mmap");
+    madvise(mapping, size, MADV_SEQUENTIAL);
+    BulkParseResult result = parseAddresses(std::string_view(static_cast<const char*>(mapping), size), threads);
+    munmap(mapping, size);
+    return result;
+}
+#endif
+
+// Бенчмарк разбора: count случайных адресов в строках журнала
+// std::stringstream (operator>>), from_chars (скалярный и SIMD, если есть), пакетный разбор файла
+void benchmarkParse(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::string text;
+    std::vector<std::size_t> starts;
+    text.reserve(count * 40);
+    for (std::size_t i = 0; i < count; ++i) {
+        starts.push_back(text.size());
+        std::uint32_t address = random_generator();
+        // Смесь длин октетов: часть адресов из малых чисел
+        if (i % 4 == 0) address &= 0x3F3F3F3F;
+        for (int octet = 0; octet < 4; ++octet) {
+            text += std::to_string(address >> (24 - 8 * octet) & 0xFF);
+            text += octet < 3 ? '.' : ' ';
+        }
+        text += "- - \"GET /index.html HTTP/1.1\" 200\n";
+    }
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - begin).count();
+    };
+    auto rate = [](std::size_t addresses, double seconds) { return addresses / seconds / 1e6; };
+    std::uint64_t checksum = 0;  // Не дает компилятору выбросить разбор
+
+    std::size_t streamCount = std::min<std::size_t>(count, 1'000'000);
+    double streamTime = measure([&] {
+        std::stringstream ss;
+        for (std::size_t i = 0; i < streamCount; ++i) {
+            ss.clear();
+            ss.str(std::string(text.data() + starts[i], text.find(' ', starts[i]) - starts[i]));
+            IPv4 address;
+            ss >> address;
+            checksum += address == IPv4() ? 0 : 1;
+        }
+    });
+    double scalarTime = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            std::array<std::uint8_t, 4> octets;
+            const char* end = IPv4::parseScalar(text.data() + starts[i], text.data() + text.size(), octets);
+            checksum += end != nullptr ? octets[3] : 0;
+        }
+    });
+    double fromCharsTime = measure([&] {
+        for (std::size_t i = 0; i < count; ++i) {
+            IPv4 address;
+            auto result = from_chars(text.data() + starts[i], text.data() + text.size(), address);
+            checksum += result.ec == std::errc{} ? 1 : 0;
+        }
+    });
+    std::cout << count << " log lines, Maddr/s: stringstream " << rate(streamCount, streamTime) << ", scalar "
+              << rate(count, scalarTime) << ", from_chars" <<
+#if defined(__SSSE3__)
+        " (SIMD) "
+#else
+        " (scalar) "
+#endif
+              << rate(count, fromCharsTime) << std::endl;
+
+#if defined(__linux__)
+    std::string path = (std::filesystem::temp_directory_path() / "ipv4_benchmark.log").string();
+    {
+        std::ofstream file(path, std::ios::binary);
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    std::cout << "  mmap file (" << text.size() / (1 << 20) << " MB), Maddr/s:";
+    for (unsigned threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+        BulkParseResult result;
+        double time = measure([&] { result = parseAddressFile(path, threads); });
+        assert(result.addresses.size() == count && result.invalidLines == 0);
+        std::cout << " " << threads << " threads " << rate(count, time);
+        if (threads == maxThreads) break;
+    }
+    std::cout << " [checksum " << checksum << "]" << std::endl;
+    std::filesystem::remove(path);
+#endif
+}
+
+// Бенчмарк форматирования count случайных адресов:
+// std::stringstream (operator<<), to_chars в один буфер, пакетное форматирование по числу потоков
+void benchmarkFormat(std::size_t count) {
+    std::mt19937 random_generator(42);
+    std::vector<IPv4> addresses;
+    addresses.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        std::uint32_t address = random_generator();
+        addresses.emplace_back(address >> 24, address >> 16 & 255, address >> 8 & 255, address & 255);
+    }
+    auto measure = [](auto&& function) {
+        auto begin = std::chrono::steady_clock::now();
+        function();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double>(end - begin).count();
+    };
+    auto rate = [](std::size_t addresses, double seconds) { return addresses / seconds / 1e6; };
+    std::size_t checksum = 0;  // Не дает компилятору выбросить форматирование
+
+    std::size_t streamCount = std::min<std::size_t>(count, 1'000'000);
+    double streamTime = measure([&] {
+        std::stringstream ss;
+        for (std::size_t i = 0; i < streamCount; ++i) {
+            ss << addresses[i];
+            ss << '\n';
+        }
+        checksum += ss.str().size();
+    });
+    std::vector<char> buffer(count * 16);
+    double toCharsTime = measure([&] {
+        char* out = buffer.data();
+        char* end = buffer.data() + buffer.size();
+        for (const IPv4& address : addresses) {
+            out = to_chars(out, end, address).ptr;
+            *out++ = '\n';
+        }
+        checksum += static_cast<std::size_t>(out - buffer.data());
+    });
+    std::cout << count << " addresses, Maddr/s: stringstream " << rate(streamCount, streamTime) << ", to_chars "
+              << rate(count, toCharsTime) << ", bulk:";
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1;; threads = std::min(threads * 2, maxThreads)) {
+        double time = measure([&] { checksum += formatAddresses(addresses, threads).size(); });
+        std::cout << " " << threads << " threads " << rate(count, time);
+        if (threads == maxThreads) break;
+    }
+    std::cout << " [checksum " << checksum << "]" << std::endl;
+}
+
 // Главная функция программы
-int main() {
+int main(int argc, char* argv[]) {
     // Тест 1: Конструкторы
     IPv4 ip1;                    // Конструктор по умолчанию: 0.0.0.0
     IPv4 ip2(192, 168, 1, 1);   // Конструктор с параметрами
@@ -192,6 +623,100 @@ int main() {
     --ip10;                       // Декремент - должно произойти underflow
     assert(ip10 == IPv4(255, 255, 255, 255));  // Проверяем установку максимума
     std::cout << "Edge cases test passed" << std::endl;  // Сообщение об успехе
+
+    // Тест 8: from_chars и parse - корректные и некорректные адреса
+    assert(IPv4::parse("192.168.1.1") == IPv4(192, 168, 1, 1));
+    assert(IPv4::parse("0.0.0.0") == IPv4(0, 0, 0, 0));
+    assert(IPv4::parse("255.255.255.255") == IPv4(255, 255, 255, 255));
+    for (const char* bad : {"", "1.2.3", "1.2.3.4.", "1.2.3.4.5", "256.1.1.1", "1.2.3.256", "01.2.3.4", "1.2.3.04",
+                            "1..3.4", ".1.2.3.4", "1.2.3.4 ", "+1.2.3.4", "-1.2.3.4", "1.2.3.1000", "1234.1.1.1",
+                            "a.b.c.d", "1.2.3.4a", "1.2.3.-4", " 1.2.3.4", "999.999.999.999"}) {
+        assert(!IPv4::parse(bad));
+    }
+    {
+        // Префиксный разбор: ptr указывает на символ после адреса; одинаково для коротких и длинных буферов
+        std::string line = "10.20.30.40 - - [log line padding to exceed sixteen bytes]";
+        IPv4 address;
+        auto [end, error] = from_chars(line.data(), line.data() + line.size(), address);
+        assert(error == std::errc{} && end == line.data() + 11 && address == IPv4(10, 20, 30, 40));
+        auto failed = from_chars(line.data() + 1, line.data() + line.size(), address);  // "0.20.30.40 ..." тоже корректен
+        assert(failed.ec == std::errc{} && address == IPv4(0, 20, 30, 40));
+        auto invalid = from_chars(line.data() + 2, line.data() + line.size(), address);  // ".20..." - ошибка
+        assert(invalid.ec == std::errc::invalid_argument && invalid.ptr == line.data() + 2 && address == IPv4(0, 20, 30, 40));
+        // Случайные строки: SIMD и скалярный путь дают одинаковый результат
+        std::mt19937 random_generator(7);
+        const char alphabet[] = "0123456789...  ";
+        for (int iteration = 0; iteration < 200'000; ++iteration) {
+            std::string candidate(24, ' ');
+            for (int i = 0; i < 17; ++i) candidate[i] = alphabet[random_generator() % (sizeof(alphabet) - 1)];
+            if (iteration % 2 == 0) { // Половина - корректные адреса в начале
+                std::uint32_t value = random_generator();
+                std::string ip = std::to_string(value >> 24) + '.' + std::to_string(value >> 16 & 255) + '.' +
+                                 std::to_string(value >> 8 & 255) + '.' + std::to_string(value & 255);
+                candidate.replace(0, ip.size(), ip);
+            }
+            std::array<std::uint8_t, 4> scalarOctets{};
+            const char* scalarEnd = IPv4::parseScalar(candidate.data(), candidate.data() + candidate.size(), scalarOctets);
+            IPv4 parsed;
+            auto result = from_chars(candidate.data(), candidate.data() + candidate.size(), parsed);
+            assert((result.ec == std::errc{}) == (scalarEnd != nullptr));
+            if (scalarEnd != nullptr) {
+                assert(result.ptr == scalarEnd && parsed == IPv4(scalarOctets[0], scalarOctets[1], scalarOctets[2], scalarOctets[3]));
+            }
+        }
+        // Пакетный разбор: порядок строк, некорректные и пустые строки
+        std::string log = "1.2.3.4 GET\n\n300.1.1.1 bad\n5.6.7.8\n9.10.11.12\tx\r\n1.2.3.4x\n13.14.15.16";
+        BulkParseResult result = parseAddresses(log, 4);
+        assert((result.addresses == std::vector<IPv4>{IPv4(1, 2, 3, 4), IPv4(5, 6, 7, 8), IPv4(9, 10, 11, 12), IPv4(13, 14, 15, 16)}));
+        assert(result.invalidLines == 2);
+        // Большой журнал делится между потоками; результат совпадает с однопоточным
+        std::string big;
+        for (int i = 0; i < 20'000; ++i) big += std::to_string(i % 256) + ".0.0." + std::to_string(i / 256) + (i % 7 ? " ok\n" : "0000\n");
+        BulkParseResult single = parseAddresses(big, 1), parallel = parseAddresses(big, 4);
+        assert(single.addresses == parallel.addresses && single.invalidLines == parallel.invalidLines);
+        assert(parallel.addresses.size() + parallel.invalidLines == 20'000 && parallel.addresses[0] == IPv4(1, 0, 0, 0));
+    }
+    std::cout << "from_chars test passed" << std::endl;
+
+    // Тест 9: to_chars - все октеты, нехватка места, пакетное форматирование
+    {
+        for (unsigned value = 0; value < 256; ++value) {
+            std::uint8_t octet = static_cast<std::uint8_t>(value);
+            IPv4 address(octet, static_cast<std::uint8_t>(255 - value), octet, 7);
+            std::stringstream ss;
+            ss << address;
+            assert(address.to_string() == ss.str());
+            assert(IPv4::parse(address.to_string()) == address);
+        }
+        char small[15];
+        IPv4 widest(255, 255, 255, 255);
+        auto tooSmall = to_chars(small, small + 14, widest);
+        assert(tooSmall.ec == std::errc::value_too_large && tooSmall.ptr == small + 14);
+        auto exact = to_chars(small, small + 15, widest);  // Ровно 15 байт без лишних записей
+        assert(exact.ec == std::errc{} && std::string_view(small, exact.ptr) == "255.255.255.255");
+        char guarded[8] = {'#', '#', '#', '#', '#', '#', '#', '#'};
+        auto shortest = to_chars(guarded, guarded + 7, IPv4(1, 2, 3, 4));
+        assert(shortest.ec == std::errc{} && std::string_view(guarded, 8) == "1.2.3.4#");
+
+        std::mt19937 random_generator(11);
+        std::vector<IPv4> list;
+        std::string expected;
+        for (int i = 0; i < 50'000; ++i) {
+            std::uint32_t value = random_generator() >> (i % 4 * 8);  // Смесь коротких и длинных адресов
+            list.emplace_back(value >> 24, value >> 16 & 255, value >> 8 & 255, value & 255);
+            expected += list.back().to_string() + '\n';
+        }
+        assert(formatAddresses(list, 1) == expected);
+        assert(formatAddresses(list, 4) == expected);  // Границы частей не портят соседние адреса
+        assert(formatAddresses({}, 4).empty());
+        assert(parseAddresses(expected, 4).addresses == list);  // Обратный разбор
+    }
+    std::cout << "to_chars test passed" << std::endl;
+
+    // Размер бенчмарка из аргументов командной строки (по умолчанию 1e7 адресов)
+    std::size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000;
+    benchmarkParse(count);
+    benchmarkFormat(count);
     
     return 0;  // Успешное завершение программы
 }
\ No newline at end of file